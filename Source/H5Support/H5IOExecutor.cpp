@@ -0,0 +1,155 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5IOExecutor.h"
+
+#include "H5Support/H5ScopedDatasetCreationOptions.h"
+
+#if defined(H5Support_NAMESPACE)
+using namespace H5Support_NAMESPACE;
+#endif
+
+namespace
+{
+// The executor whose I/O thread is the calling thread, if any
+thread_local const H5IOExecutor* s_CurrentExecutor = nullptr;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5IOExecutor& H5IOExecutor::Instance()
+{
+  static H5IOExecutor executor;
+  return executor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5IOExecutor::H5IOExecutor() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5IOExecutor::~H5IOExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop = true;
+  }
+  m_TaskAvailable.notify_all();
+  if(m_Thread.joinable())
+  {
+    m_Thread.join();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5IOExecutor::isIOThread() const
+{
+  return s_CurrentExecutor == this;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5IOExecutor::waitForIdle()
+{
+  if(isIOThread())
+  {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_Idle.wait(lock, [this] { return m_Tasks.empty() && !m_Busy; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5IOExecutor::enqueue(std::function<void()> task)
+{
+  if(isIOThread())
+  {
+    task();
+    return;
+  }
+
+  // The dataset creation options are per thread, so carry the caller's options over. The library
+  // mutex is not held for the whole task; each H5Support call in it locks the mutex on its own.
+  H5Lite::DatasetCreationOptions options = H5Lite::getDatasetCreationOptions();
+  std::function<void()> wrapped = [options, task] {
+    H5ScopedDatasetCreationOptions scopedOptions(options);
+    task();
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Tasks.push_back(std::move(wrapped));
+    // The thread is only started once something is actually submitted
+    if(!m_Thread.joinable())
+    {
+      m_Thread = std::thread(&H5IOExecutor::run, this);
+    }
+  }
+  m_TaskAvailable.notify_one();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5IOExecutor::run()
+{
+  s_CurrentExecutor = this;
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while(true)
+  {
+    m_TaskAvailable.wait(lock, [this] { return m_Stop || !m_Tasks.empty(); });
+    if(m_Tasks.empty())
+    {
+      // Only reached when stopping
+      break;
+    }
+    std::function<void()> task = std::move(m_Tasks.front());
+    m_Tasks.pop_front();
+    m_Busy = true;
+    lock.unlock();
+    task();
+    lock.lock();
+    m_Busy = false;
+    if(m_Tasks.empty())
+    {
+      m_Idle.notify_all();
+    }
+  }
+}
@@ -0,0 +1,126 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5Support.h"
+
+#if defined (H5Support_NAMESPACE)
+namespace H5Support_NAMESPACE
+{
+#endif
+
+/**
+* @brief This class runs HDF5 work on a single dedicated I/O thread so the calling thread
+* can keep computing while data is written or read. Tasks run one at a time in the order
+* they were submitted, each one using the dataset creation options that were active on the
+* submitting thread. A task does not hold H5Lite::GetLibraryMutex() while it runs: every
+* H5Support call made by the task locks it for the duration of that call only, so other
+* threads can still use H5Support between the calls of a long task. A task that makes raw
+* HDF5 calls must hold the mutex around them itself. A task submitted from
+* the I/O thread itself runs immediately so tasks may submit and wait on other tasks.
+*/
+class H5Support_EXPORT H5IOExecutor
+{
+
+  public:
+
+    /**
+     * @brief Returns the executor shared by the whole process
+     * @return
+     */
+    static H5IOExecutor& Instance();
+
+    H5IOExecutor();
+
+    /**
+     * @brief Runs any tasks that are still queued and then stops the I/O thread
+     */
+    ~H5IOExecutor();
+
+    /**
+     * @brief Queues a task on the I/O thread
+     * @param func Callable taking no arguments
+     * @return A future holding the value returned by the task
+     */
+    template <typename Func>
+    std::future<typename std::result_of<Func()>::type> submit(Func func)
+    {
+      using ResultType = typename std::result_of<Func()>::type;
+      std::shared_ptr<std::packaged_task<ResultType()>> task = std::make_shared<std::packaged_task<ResultType()>>(std::move(func));
+      std::future<ResultType> future = task->get_future();
+      enqueue([task] { (*task)(); });
+      return future;
+    }
+
+    /**
+     * @brief Returns true when called from the I/O thread
+     * @return
+     */
+    bool isIOThread() const;
+
+    /**
+     * @brief Blocks until every task submitted so far has finished
+     */
+    void waitForIdle();
+
+  private:
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_Idle;
+    std::deque<std::function<void()>> m_Tasks;
+    bool m_Busy = false;
+    bool m_Stop = false;
+    std::thread m_Thread;
+
+    void enqueue(std::function<void()> task);
+
+    void run();
+
+    H5IOExecutor(const H5IOExecutor&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5IOExecutor&) = delete; // Move assignment Not Implemented
+};
+
+
+#if defined (H5Support_NAMESPACE)
+}
+#endif
+
@@ -35,7 +35,9 @@
 
 #include <H5Support/H5Lite.h>
 
+#include <algorithm>
 #include <cstring>
+#include <memory>
 
 #if defined(H5Support_NAMESPACE)
 using namespace H5Support_NAMESPACE;
@@ -135,6 +137,114 @@ void H5Lite::disableErrorHandlers()
   HDF_ERROR_HANDLER_OFF;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::recursive_mutex& H5Lite::GetLibraryMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
+namespace
+{
+// Registered HDF5 filter id of the LZ4 compression plugin
+const H5Z_filter_t k_LZ4FilterId = 32004;
+
+// Options used by each thread for datasets created without explicit options
+thread_local H5Lite::DatasetCreationOptions s_DatasetCreationOptions;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5Lite::DatasetCreationOptions H5Lite::setDatasetCreationOptions(const DatasetCreationOptions& options)
+{
+  DatasetCreationOptions previous = s_DatasetCreationOptions;
+  s_DatasetCreationOptions = options;
+  return previous;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const H5Lite::DatasetCreationOptions& H5Lite::getDatasetCreationOptions()
+{
+  return s_DatasetCreationOptions;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5Lite::createDatasetCreationPropertyList(int32_t rank, const hsize_t* dims, size_t typeSize, const DatasetCreationOptions& options)
+{
+  if(!options.isChunked() || rank <= 0 || typeSize == 0)
+  {
+    return H5P_DEFAULT;
+  }
+  for(int32_t i = 0; i < rank; i++)
+  {
+    // Empty datasets can not be chunked
+    if(dims[i] == 0)
+    {
+      return H5P_DEFAULT;
+    }
+  }
+
+  std::vector<hsize_t> chunkDims(rank, 1);
+  if(options.chunkDims.size() == static_cast<size_t>(rank))
+  {
+    for(int32_t i = 0; i < rank; i++)
+    {
+      chunkDims[i] = std::max<hsize_t>(1, std::min(options.chunkDims[i], dims[i]));
+    }
+  }
+  else
+  {
+    // Take whole slabs of the slowest dimension that still fit in the target size. If a single
+    // slab is too big, take one index of that dimension and repeat with the next one.
+    size_t targetBytes = std::max(options.chunkBytes, typeSize);
+    for(int32_t i = 0; i < rank; i++)
+    {
+      hsize_t slabBytes = typeSize;
+      for(int32_t j = i + 1; j < rank; j++)
+      {
+        slabBytes *= dims[j];
+      }
+      if(slabBytes <= targetBytes)
+      {
+        chunkDims[i] = std::max<hsize_t>(1, std::min<hsize_t>(targetBytes / slabBytes, dims[i]));
+        for(int32_t j = i + 1; j < rank; j++)
+        {
+          chunkDims[j] = dims[j];
+        }
+        break;
+      }
+    }
+  }
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return H5P_DEFAULT;
+  }
+  H5Pset_chunk(dcpl, rank, chunkDims.data());
+  if(options.shuffle)
+  {
+    H5Pset_shuffle(dcpl);
+  }
+  if(options.fastCompression && H5Zfilter_avail(k_LZ4FilterId) > 0)
+  {
+    H5Pset_filter(dcpl, k_LZ4FilterId, H5Z_FLAG_OPTIONAL, 0, nullptr);
+  }
+  else if((options.deflateLevel > 0 || options.fastCompression) && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+  {
+    uint32_t level = options.deflateLevel > 0 ? static_cast<uint32_t>(std::min(options.deflateLevel, 9)) : 1;
+    H5Pset_deflate(dcpl, level);
+  }
+  return dcpl;
+}
+
 // -----------------------------------------------------------------------------
 //  Opens an ID for HDF5 operations
 // -----------------------------------------------------------------------------
@@ -467,56 +577,58 @@ herr_t H5Lite::writeStringDataset(hid_t loc_id, const std::string& dsetName, siz
 //
 // -----------------------------------------------------------------------------
 herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<std::string>& data)
+{
+  std::vector<const char*> strings(data.size());
+  for(size_t i = 0; i < data.size(); i++)
+  {
+    strings[i] = data[i].c_str();
+  }
+  return writeVectorOfStringsDataset(loc_id, dsetName, strings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data)
 {
   H5SUPPORT_MUTEX_LOCK()
 
   hid_t sid = -1;
-  hid_t memspace = -1;
   hid_t datatype = -1;
   hid_t did = -1;
   herr_t err = -1;
   herr_t retErr = 0;
 
+  // A null pointer would be stored as a null string which readVectorOfStringDataset()
+  // cannot turn into a std::string, so write those entries as empty strings instead.
+  const char* empty = "";
+  std::vector<const char*> strings(data.size());
+  for(size_t i = 0; i < data.size(); i++)
+  {
+    strings[i] = (nullptr == data[i]) ? empty : data[i];
+  }
+
   hsize_t dims[1] = {data.size()};
   if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
   {
-    dims[0] = 1;
+    datatype = H5Tcopy(H5T_C_S1);
+    H5Tset_size(datatype, H5T_VARIABLE);
 
-    if((memspace = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+    if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
     {
-
-      datatype = H5Tcopy(H5T_C_S1);
-      H5Tset_size(datatype, H5T_VARIABLE);
-
-      if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+      // Write every string in one call instead of one hyperslab selection per string
+      if(!strings.empty())
       {
-
-        //
-        // Select the "memory" to be written out - just 1 record.
-        hsize_t offset[] = {0};
-        hsize_t count[] = {1};
-        H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-        hsize_t m_pos = 0;
-        for(auto v : data)
+        err = H5Dwrite(did, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, strings.data());
+        if(err < 0)
         {
-          // Select the file position, 1 record at position 'pos'
-          hsize_t count[] = {1};
-          hsize_t offset[] = {m_pos++};
-          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-          const char* s = v.c_str();
-          err = H5Dwrite(did, datatype, memspace, sid, H5P_DEFAULT, &s);
-          if(err < 0)
-          {
-            std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
-            retErr = err;
-          }
+          std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
+          retErr = err;
         }
-        CloseH5D(did, err, retErr);
       }
-      H5Tclose(datatype);
-      CloseH5S(memspace, err, retErr);
+      CloseH5D(did, err, retErr);
     }
-
+    H5Tclose(datatype);
     CloseH5S(sid, err, retErr);
   }
   return retErr;
@@ -879,6 +991,67 @@ herr_t H5Lite::readStringDataset(hid_t loc_id, const std::string& dsetName, char
 //
 // -----------------------------------------------------------------------------
 herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<std::string>& data)
+{
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  herr_t err = readVectorOfStringDataset(loc_id, dsetName, buffer, offsets);
+  if(err < 0)
+  {
+    return err;
+  }
+  data.resize(offsets.size());
+  for(size_t i = 0; i < offsets.size(); i++)
+  {
+    data[i] = std::string(buffer.data() + offsets[i]);
+  }
+  return err;
+}
+
+namespace
+{
+const size_t k_VLenArenaBlockSize = 1024 * 1024;
+
+/**
+ * @brief Bump allocator handed to HDF5 through H5Pset_vlen_mem_manager so that
+ * reading a variable length string dataset does not malloc/free every string.
+ * Everything is released at once when the arena goes out of scope.
+ */
+class VLenStringArena
+{
+public:
+  static void* Allocate(size_t size, void* info)
+  {
+    return static_cast<VLenStringArena*>(info)->allocate(size);
+  }
+
+  static void Free(void* /* mem */, void* /* info */)
+  {
+  }
+
+  void* allocate(size_t size)
+  {
+    if(m_Blocks.empty() || m_Used + size > m_BlockSize)
+    {
+      m_BlockSize = std::max(k_VLenArenaBlockSize, size);
+      m_Blocks.emplace_back(new char[m_BlockSize]);
+      m_Used = 0;
+    }
+    char* mem = m_Blocks.back().get() + m_Used;
+    m_Used += size;
+    return mem;
+  }
+
+private:
+  std::vector<std::unique_ptr<char[]>> m_Blocks;
+  size_t m_BlockSize = 0;
+  size_t m_Used = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<char>& buffer, std::vector<size_t>& offsets)
 {
   H5SUPPORT_MUTEX_LOCK()
 
@@ -887,73 +1060,77 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
   herr_t err = 0;
   herr_t retErr = 0;
 
+  buffer.clear();
+  offsets.clear();
+
   did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
   if(did < 0)
   {
     std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
     return -1;
   }
-  /*
-  * Get the datatype.
-  */
   tid = H5Dget_type(did);
   if(tid >= 0)
   {
     hsize_t dims[1] = {0};
-    /*
-    * Get dataspace and allocate memory for read buffer.
-    */
     hid_t sid = H5Dget_space(did);
     int ndims = H5Sget_simple_extent_dims(sid, dims, nullptr);
     if(ndims != 1)
     {
       CloseH5S(sid, err, retErr);
       CloseH5T(tid, err, retErr);
+      CloseH5D(did, err, retErr);
       std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
       return -2;
     }
-    std::vector<char*> rdata(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
-    {
-      rdata[i] = nullptr;
-    }
+    std::vector<char*> rdata(dims[0], nullptr);
 
-    /*
-    * Create the memory datatype.
-    */
     hid_t memtype = H5Tcopy(H5T_C_S1);
-    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
+    H5Tset_size(memtype, H5T_VARIABLE);
 
-    /*
-    * Read the data.
-    */
-    status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(rdata.front()));
+    // All of the strings are allocated out of the arena and released together
+    VLenStringArena arena;
+    hid_t xferPlist = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_vlen_mem_manager(xferPlist, &VLenStringArena::Allocate, &arena, &VLenStringArena::Free, nullptr);
+
+    herr_t status = 0;
+    if(!rdata.empty())
+    {
+      status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, xferPlist, rdata.data());
+    }
+    H5Pclose(xferPlist);
     if(status < 0)
     {
-      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
       CloseH5S(sid, err, retErr);
       CloseH5T(tid, err, retErr);
       CloseH5T(memtype, err, retErr);
+      CloseH5D(did, err, retErr);
       std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
       return -3;
     }
-    /*
-    * copy the data into the vector of strings
-    */
-    data.resize(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
+
+    // Pack the strings back to back, each one null terminated
+    std::vector<size_t> lengths(rdata.size(), 0);
+    size_t totalSize = 0;
+    for(size_t i = 0; i < rdata.size(); i++)
     {
-      // printf("%s[%d]: %s\n", "VlenStrings", i, rdata[i].p);
-      std::string str = std::string(rdata[i]);
-      data[i] = str;
+      lengths[i] = (nullptr == rdata[i]) ? 0 : std::strlen(rdata[i]);
+      totalSize += lengths[i] + 1;
     }
-    /*
-    * Close and release resources.  Note that H5Dvlen_reclaim works
-    * for variable-length strings as well as variable-length arrays.
-    * Also note that we must still free the array of pointers stored
-    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
-    */
-    status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
+    buffer.resize(totalSize);
+    offsets.resize(rdata.size());
+    size_t offset = 0;
+    for(size_t i = 0; i < rdata.size(); i++)
+    {
+      offsets[i] = offset;
+      if(lengths[i] > 0)
+      {
+        std::memcpy(buffer.data() + offset, rdata[i], lengths[i]);
+      }
+      offset += lengths[i];
+      buffer[offset++] = '\0';
+    }
+
     CloseH5S(sid, err, retErr);
     CloseH5T(tid, err, retErr);
     CloseH5T(memtype, err, retErr);
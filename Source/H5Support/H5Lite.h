@@ -27,10 +27,12 @@
 #include "H5Support/H5Support.h"
 #include "H5Support/H5Macros.h"
 
+// HDF5 is not thread safe as a whole, so every call made through H5Support is
+// serialized on one library wide mutex. It is recursive because the H5Lite
+// functions call each other.
 #ifdef H5Support_USE_MUTEX
 #define H5SUPPORT_MUTEX_LOCK()\
-  static std::mutex mutex;\
-  std::lock_guard<std::mutex> lock(mutex);
+  std::lock_guard<std::recursive_mutex> lock(H5Lite::GetLibraryMutex());
 #else
 #define H5SUPPORT_MUTEX_LOCK()
 
@@ -61,6 +63,59 @@ namespace H5Support_NAMESPACE
   class H5Lite
   {
     public:
+      /**
+       * @brief Returns the mutex that serializes all calls into the HDF5 library made
+       * through H5Support. Each H5Support call holds it only while that call runs. Code that
+       * makes raw HDF5 calls from more than one thread should do the same and not hold it
+       * across long running work.
+       * @return
+       */
+      static H5Support_EXPORT std::recursive_mutex& GetLibraryMutex();
+
+      /**
+       * @brief The DatasetCreationOptions struct describes how new datasets are laid out on disk.
+       * The default values create contiguous, uncompressed datasets.
+       */
+      struct DatasetCreationOptions
+      {
+        std::vector<hsize_t> chunkDims; // Chunk shape, slowest to fastest. Empty picks a shape automatically
+        size_t chunkBytes = 1048576;     // Target size of an automatically shaped chunk
+        int32_t deflateLevel = 0;        // gzip level 1-9, 0 disables deflate
+        bool shuffle = false;            // Byte shuffle before compressing
+        bool fastCompression = false;    // Use the LZ4 filter plugin when HDF5 can load it, otherwise deflate
+
+        bool isChunked() const
+        {
+          return !chunkDims.empty() || deflateLevel > 0 || shuffle || fastCompression;
+        }
+      };
+
+      /**
+       * @brief setDatasetCreationOptions Sets the options used for datasets created by the calling thread
+       * when no options are passed explicitly. Returns the previous options.
+       * @param options
+       * @return
+       */
+      static H5Support_EXPORT DatasetCreationOptions setDatasetCreationOptions(const DatasetCreationOptions& options);
+
+      /**
+       * @brief getDatasetCreationOptions Returns the options used for datasets created by the calling thread
+       * @return
+       */
+      static H5Support_EXPORT const DatasetCreationOptions& getDatasetCreationOptions();
+
+      /**
+       * @brief createDatasetCreationPropertyList Creates the dataset creation property list for the options.
+       * Compressed datasets are always chunked. Without an explicit chunk shape whole slabs of the slowest
+       * dimensions are grouped up to options.chunkBytes, so for image data a chunk holds complete slices.
+       * @param rank The number of dimensions
+       * @param dims The dimensions of the dataset
+       * @param typeSize The size of a single element in bytes
+       * @param options
+       * @return H5P_DEFAULT for a contiguous dataset, otherwise a property list that must be closed with H5Pclose
+       */
+      static H5Support_EXPORT hid_t createDatasetCreationPropertyList(int32_t rank, const hsize_t* dims, size_t typeSize, const DatasetCreationOptions& options);
+
       /**
        * @brief Turns off the global error handler/reporting objects. Note that once
        * they are turned off using this method they CAN NOT be turned back on. If you
@@ -325,6 +380,7 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param options The chunking and compression of the new dataset
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -332,7 +388,8 @@ namespace H5Support_NAMESPACE
                                          const std::string& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         const DatasetCreationOptions& options = getDatasetCreationOptions())
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -363,7 +420,12 @@ namespace H5Support_NAMESPACE
         }
         // Create the Dataset
         // This will fail if dsetName contains a "/"!
-        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        hid_t dcpl = createDatasetCreationPropertyList(rank, dims, sizeof(T), options);
+        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        if (dcpl != H5P_DEFAULT)
+        {
+          H5Pclose(dcpl);
+        }
         if ( did >= 0 )
         {
           err = H5Dwrite( did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
@@ -410,6 +472,7 @@ namespace H5Support_NAMESPACE
        * @param rank
        * @param dims
        * @param data
+       * @param options The chunking and compression used if the dataset has to be created
        * @return
        */
       template <typename T>
@@ -417,7 +480,8 @@ namespace H5Support_NAMESPACE
                                            const std::string& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           const DatasetCreationOptions& options = getDatasetCreationOptions())
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -451,7 +515,12 @@ namespace H5Support_NAMESPACE
         HDF_ERROR_HANDLER_ON
         if ( did < 0 ) // dataset does not exist so create it
         {
-          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+          hid_t dcpl = createDatasetCreationPropertyList(rank, dims, sizeof(T), options);
+          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+          if (dcpl != H5P_DEFAULT)
+          {
+            H5Pclose(dcpl);
+          }
         }
         if ( did >= 0 )
         {
@@ -662,6 +731,19 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
                                                                  const std::string& dsetName,
                                                                  const std::vector<std::string>& data);
+
+      /**
+      * @brief Writes a variable length string dataset from an array of C string
+      * pointers using a single H5Dwrite call. Null pointers are written as empty
+      * strings.
+      * @param loc_id
+      * @param dsetName
+      * @param data
+      * @return
+      */
+      static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
+                                                                 const std::string& dsetName,
+                                                                 const std::vector<const char*>& data);
       /**
        * @brief Writes an Attribute to an HDF5 Object
        * @param loc_id The Parent Location of the HDFobject that is getting the attribute
@@ -1118,6 +1200,94 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Reads a rectangular hyperslab of a dataset into a preallocated array. Only
+       * the selected region is read from the file, which for chunked datasets means only
+       * the chunks that intersect the region are touched.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The start of the region in each dimension, slowest to fastest. The
+       * size must match the rank of the dataset.
+       * @param count The extent of the region in each dimension, slowest to fastest.
+       * @param data A Pointer to the PreAllocated Array that will hold the product of count
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& offset,
+                                                const std::vector<hsize_t>& count,
+                                                T* data)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        T test = 0x00;
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (loc_id < 0)
+        {
+          std::cout  << "loc_id was Negative: This is not allowed." << std::endl;
+          return -2;
+        }
+        if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        if (offset.size() != count.size())
+        {
+          std::cout  << "The hyperslab offset and count must have the same size." << std::endl;
+          return -4;
+        }
+        hid_t did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+        herr_t err = 0;
+        herr_t retErr = 0;
+        hid_t fileSpace = H5Dget_space(did);
+        int rank = H5Sget_simple_extent_ndims(fileSpace);
+        if (rank < 0 || static_cast<size_t>(rank) != offset.size())
+        {
+          std::cout  << "The hyperslab rank does not match the rank of Dataset " << dsetName << std::endl;
+          retErr = -5;
+        }
+        else
+        {
+          err = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+          if (err < 0 || H5Sselect_valid(fileSpace) <= 0)
+          {
+            std::cout  << "The hyperslab lies outside the extents of Dataset " << dsetName << std::endl;
+            retErr = -6;
+          }
+          else
+          {
+            hid_t memSpace = H5Screate_simple(rank, count.data(), nullptr);
+            err = H5Dread(did, dataType, memSpace, fileSpace, H5P_DEFAULT, data);
+            if (err < 0)
+            {
+              std::cout  << "Error Reading Data." << std::endl;
+              retErr = err;
+            }
+            H5Sclose(memSpace);
+          }
+        }
+        H5Sclose(fileSpace);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
@@ -1316,6 +1486,22 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
                                                                const std::string& dsetName,
                                                                std::vector<std::string>& data);
+
+      /**
+        * @brief Reads a variable length string dataset into a single packed buffer.
+        * Each string is stored null terminated in @p buffer and starts at the
+        * matching entry of @p offsets. The strings are read with one H5Dread and a
+        * block allocator so no per-string allocations are made.
+        * @param loc_id
+        * @param dsetName
+        * @param buffer
+        * @param offsets
+        * @return
+        */
+      static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
+                                                               const std::string& dsetName,
+                                                               std::vector<char>& buffer,
+                                                               std::vector<size_t>& offsets);
       /**
        * @brief Reads an Attribute from an HDF5 Object.
        *
@@ -0,0 +1,67 @@
+/* ============================================================================
+* Copyright (c) 2018 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "H5Support/H5Lite.h"
+#include "H5Support/H5Support.h"
+
+#if defined (H5Support_NAMESPACE)
+namespace H5Support_NAMESPACE
+{
+#endif
+
+/**
+* @brief This class sets the dataset creation options that H5Lite uses on the calling thread
+* until the instance goes out of scope, at which point the previous options are put back
+* in place
+*/
+class H5Support_EXPORT H5ScopedDatasetCreationOptions
+{
+
+  public:
+
+    H5ScopedDatasetCreationOptions(const H5Lite::DatasetCreationOptions& options);
+
+    ~H5ScopedDatasetCreationOptions();
+
+  private:
+    H5Lite::DatasetCreationOptions m_PreviousOptions;
+
+    H5ScopedDatasetCreationOptions(const H5ScopedDatasetCreationOptions&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5ScopedDatasetCreationOptions&) = delete;                 // Move assignment Not Implemented
+};
+
+
+#if defined (H5Support_NAMESPACE)
+}
+#endif
+
@@ -35,6 +35,10 @@
 
 #include "H5ScopedSentinel.h"
 
+#if defined(H5Support_NAMESPACE)
+using namespace H5Support_NAMESPACE;
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,6 +48,7 @@ H5ScopedFileSentinel::H5ScopedFileSentinel(hid_t* fileId, bool turnOffErrors)
 {
   if(m_TurnOffErrors)
   {
+    H5SUPPORT_MUTEX_LOCK()
     H5Eget_auto(H5E_DEFAULT, &_oldHDF_error_func, &_oldHDF_error_client_data);
     H5Eset_auto(H5E_DEFAULT, nullptr, nullptr);
   }
@@ -54,6 +59,8 @@ H5ScopedFileSentinel::H5ScopedFileSentinel(hid_t* fileId, bool turnOffErrors)
 // -----------------------------------------------------------------------------
 H5ScopedFileSentinel::~H5ScopedFileSentinel()
 {
+  H5SUPPORT_MUTEX_LOCK()
+
   if(m_TurnOffErrors)
   {
     H5Eset_auto(H5E_DEFAULT, _oldHDF_error_func, _oldHDF_error_client_data);
@@ -107,6 +114,7 @@ H5ScopedGroupSentinel::H5ScopedGroupSentinel(hid_t* gid, bool turnOffErrors)
   m_Groups.push_back(gid);
   if(m_TurnOffErrors)
   {
+    H5SUPPORT_MUTEX_LOCK()
     H5Eget_auto(H5E_DEFAULT, &_oldHDF_error_func, &_oldHDF_error_client_data);
     H5Eset_auto(H5E_DEFAULT, nullptr, nullptr);
   }
@@ -117,6 +125,8 @@ H5ScopedGroupSentinel::H5ScopedGroupSentinel(hid_t* gid, bool turnOffErrors)
 // -----------------------------------------------------------------------------
 H5ScopedGroupSentinel::~H5ScopedGroupSentinel()
 {
+  H5SUPPORT_MUTEX_LOCK()
+
   if(m_TurnOffErrors)
   {
     H5Eset_auto(H5E_DEFAULT, _oldHDF_error_func, _oldHDF_error_client_data);
@@ -148,6 +158,7 @@ H5ScopedObjectSentinel::H5ScopedObjectSentinel(hid_t* gid, bool turnOffErrors)
   m_Groups.push_back(gid);
   if(m_TurnOffErrors)
   {
+    H5SUPPORT_MUTEX_LOCK()
     H5Eget_auto(H5E_DEFAULT, &_oldHDF_error_func, &_oldHDF_error_client_data);
     H5Eset_auto(H5E_DEFAULT, nullptr, nullptr);
   }
@@ -158,6 +169,8 @@ H5ScopedObjectSentinel::H5ScopedObjectSentinel(hid_t* gid, bool turnOffErrors)
 // -----------------------------------------------------------------------------
 H5ScopedObjectSentinel::~H5ScopedObjectSentinel()
 {
+  H5SUPPORT_MUTEX_LOCK()
+
   if(m_TurnOffErrors)
   {
     H5Eset_auto(H5E_DEFAULT, _oldHDF_error_func, _oldHDF_error_client_data);
@@ -194,6 +207,8 @@ H5GroupAutoCloser::H5GroupAutoCloser(hid_t* groupId)
 // -----------------------------------------------------------------------------
 H5GroupAutoCloser::~H5GroupAutoCloser()
 {
+  H5SUPPORT_MUTEX_LOCK()
+
   if(*gid > 0)
   {
     H5Gclose(*gid);
@@ -49,7 +49,8 @@ namespace H5Support_NAMESPACE
 
 /**
  * @brief The HDF5FileSentinel class ensures the HDF5 file that is currently open
- * is closed when the variable goes out of Scope
+ * is closed when the variable goes out of Scope. Like every other H5Support call, the
+ * sentinels in this file hold H5Lite::GetLibraryMutex() while they close their objects.
  */
 class H5Support_EXPORT H5ScopedFileSentinel
 {
@@ -115,59 +115,23 @@ herr_t QH5Lite::writeStringDataset(hid_t loc_id, const QString& dsetName, const
 // -----------------------------------------------------------------------------
 herr_t QH5Lite::writeVectorOfStringsDataset(hid_t loc_id, const QString& dsetName, const QVector<QString>& data)
 {
-  H5SUPPORT_MUTEX_LOCK()
-
-  hid_t sid = -1;
-  hid_t memspace = -1;
-  hid_t datatype = -1;
-  hid_t did = -1;
-  herr_t err = -1;
-  herr_t retErr = 0;
-
-  hsize_t dims[1] = {static_cast<hsize_t>(data.size())};
-  if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+  // Pack the UTF-8 bytes of every string into one buffer so the strings can be
+  // handed to HDF5 in a single write.
+  std::vector<char> buffer;
+  std::vector<size_t> offsets(static_cast<size_t>(data.size()));
+  for(int i = 0; i < data.size(); i++)
   {
-    dims[0] = 1;
-
-    if((memspace = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
-    {
-
-      datatype = H5Tcopy(H5T_C_S1);
-      H5Tset_size(datatype, H5T_VARIABLE);
-
-      if((did = H5Dcreate(loc_id, dsetName.toLocal8Bit().constData(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
-      {
-
-        //
-        // Select the "memory" to be written out - just 1 record.
-        hsize_t offset_[] = {0};
-        hsize_t count_[] = {1};
-        H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset_, nullptr, count_, nullptr);
-        hsize_t m_pos = 0;
-        for(const auto & i : data)
-        {
-          // Select the file position, 1 record at position 'pos'
-          hsize_t count[] = {1};
-          hsize_t offset[] = {m_pos++};
-          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-          std::string v = i.toStdString(); // MUST be a C String, i.e., null terminated
-          const char* s = v.c_str();
-          err = H5Dwrite(did, datatype, memspace, sid, H5P_DEFAULT, s);
-          if(err < 0)
-          {
-            qDebug() << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")";
-            retErr = err;
-          }
-        }
-        QCloseH5D(did, err, retErr);
-      }
-      H5Tclose(datatype);
-      QCloseH5S(memspace, err, retErr);
-    }
-
-    QCloseH5S(sid, err, retErr);
+    QByteArray utf8 = data[i].toUtf8();
+    offsets[i] = buffer.size();
+    buffer.insert(buffer.end(), utf8.constData(), utf8.constData() + utf8.size());
+    buffer.push_back('\0');
+  }
+  std::vector<const char*> strings(offsets.size());
+  for(size_t i = 0; i < offsets.size(); i++)
+  {
+    strings[i] = buffer.data() + offsets[i];
   }
-  return retErr;
+  return H5Lite::writeVectorOfStringsDataset(loc_id, dsetName.toStdString(), strings);
 }
 
 // -----------------------------------------------------------------------------
@@ -237,88 +201,19 @@ herr_t QH5Lite::readStringDataset(hid_t loc_id, const QString& dsetName, char* d
 // -----------------------------------------------------------------------------
 herr_t QH5Lite::readVectorOfStringDataset(hid_t loc_id, const QString& dsetName, QVector<QString>& data)
 {
-  H5SUPPORT_MUTEX_LOCK()
-
-  hid_t did; // dataset id
-  hid_t tid; // type id
-  herr_t err = 0;
-  herr_t retErr = 0;
-
-  did = H5Dopen(loc_id, dsetName.toLocal8Bit().constData(), H5P_DEFAULT);
-  if(did < 0)
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  herr_t err = H5Lite::readVectorOfStringDataset(loc_id, dsetName.toStdString(), buffer, offsets);
+  if(err < 0)
   {
-    qDebug() << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")";
-    return -1;
+    return err;
   }
-  /*
-  * Get the datatype.
-  */
-  tid = H5Dget_type(did);
-  if(tid >= 0)
+  data.resize(static_cast<int>(offsets.size()));
+  for(size_t i = 0; i < offsets.size(); i++)
   {
-    hsize_t dims[1] = {0};
-    /*
-    * Get dataspace and allocate memory for read buffer.
-    */
-    hid_t sid = H5Dget_space(did);
-    int ndims = H5Sget_simple_extent_dims(sid, dims, nullptr);
-    if(ndims != 1)
-    {
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
-      return -2;
-    }
-    std::vector<char*> rdata(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
-    {
-      rdata[i] = nullptr;
-    }
-
-    /*
-    * Create the memory datatype.
-    */
-    hid_t memtype = H5Tcopy(H5T_C_S1);
-    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
-
-    /*
-    * Read the data.
-    */
-    status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(rdata.front()));
-    if(status < 0)
-    {
-      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      CloseH5T(memtype, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName.toStdString() << ")" << std::endl;
-      return -3;
-    }
-    data.resize(dims[0]);
-    /*
-    * copy the data into the vector of strings
-    */
-    for(int i = 0; i < dims[0]; i++)
-    {
-      // printf("%s[%d]: %s\n", "VlenStrings", i, rdata[i].p);
-      QString str = QString::fromLatin1(rdata[i]);
-      data[i] = str;
-    }
-    /*
-    * Close and release resources.  Note that H5Dvlen_reclaim works
-    * for variable-length strings as well as variable-length arrays.
-    * Also note that we must still free the array of pointers stored
-    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
-    */
-    status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-    QCloseH5S(sid, err, retErr);
-    QCloseH5T(tid, err, retErr);
-    QCloseH5T(memtype, err, retErr);
+    data[static_cast<int>(i)] = QString::fromUtf8(buffer.data() + offsets[i]);
   }
-
-  QCloseH5D(did, err, retErr);
-
-  return retErr;
+  return err;
 }
 
 // -----------------------------------------------------------------------------
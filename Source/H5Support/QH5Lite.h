@@ -212,6 +212,7 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param options The chunking and compression of the new dataset
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -219,9 +220,10 @@ namespace H5Support_NAMESPACE
                                          const QString& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         const H5Lite::DatasetCreationOptions& options = H5Lite::getDatasetCreationOptions())
       {
-        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, options);
       }
 
       /**
@@ -238,9 +240,10 @@ namespace H5Support_NAMESPACE
                                            const QString& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           const H5Lite::DatasetCreationOptions& options = H5Lite::getDatasetCreationOptions())
       {
-        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, options);
       }
 
 
@@ -460,6 +463,25 @@ namespace H5Support_NAMESPACE
         return H5Lite::readPointerDataset(loc_id, dsetName.toStdString(), data);
       }
 
+      /**
+       * @brief Reads a rectangular hyperslab of a dataset into a preallocated array.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The start of the region in each dimension, slowest to fastest
+       * @param count The extent of the region in each dimension, slowest to fastest
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const QVector<hsize_t>& offset,
+                                                const QVector<hsize_t>& count,
+                                                T* data)
+      {
+        return H5Lite::readPointerDatasetHyperslab(loc_id, dsetName.toStdString(), offset.toStdVector(), count.toStdVector(), data);
+      }
+
 
       /**
        * @brief Reads data from the HDF5 File into an QVector<T> object. If the dataset
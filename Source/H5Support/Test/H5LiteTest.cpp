@@ -9,16 +9,21 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <future>
 #include <iostream>
+#include <mutex>
 #include <stdlib.h>
 #include <string>
+#include <vector>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QFile>
 #include <QtCore/QString>
 #include <QtCore/QtDebug>
 
+#include "H5Support/H5IOExecutor.h"
 #include "H5Support/H5Lite.h"
+#include "H5Support/H5ScopedDatasetCreationOptions.h"
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
@@ -1435,10 +1440,230 @@ public:
 
       QH5Utilities::closeFile(file_id);
     }
+
+    // Write from an array of C string pointers and read back into a packed buffer
+    {
+      hid_t file_id = H5Utilities::createFile(UnitTest::H5LiteTest::VLengthFile.toStdString());
+
+      std::vector<const char*> strings;
+      strings.push_back("Titanium");
+      strings.push_back(nullptr);
+      strings.push_back("");
+      strings.push_back("Nickel");
+
+      herr_t err = H5Lite::writeVectorOfStringsDataset(file_id, "VlenStrings", strings);
+      DREAM3D_REQUIRE(err >= 0)
+
+      std::vector<char> buffer;
+      std::vector<size_t> offsets;
+      err = H5Lite::readVectorOfStringDataset(file_id, "VlenStrings", buffer, offsets);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE(offsets.size() == 4)
+      DREAM3D_REQUIRE(std::string(buffer.data() + offsets[0]) == "Titanium")
+      DREAM3D_REQUIRE(std::string(buffer.data() + offsets[1]).empty())
+      DREAM3D_REQUIRE(std::string(buffer.data() + offsets[2]).empty())
+      DREAM3D_REQUIRE(std::string(buffer.data() + offsets[3]) == "Nickel")
+
+      std::vector<std::string> data;
+      err = H5Lite::readVectorOfStringDataset(file_id, "VlenStrings", data);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE(data.size() == 4)
+      DREAM3D_REQUIRE(data[3] == "Nickel")
+
+      H5Utilities::closeFile(file_id);
+    }
   }
 
 #endif
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChunkedDataset()
+  {
+    hid_t file_id = H5Fcreate(UnitTest::H5LiteTest::FileName.toLatin1().data(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    DREAM3D_REQUIRE(file_id > 0);
+
+    // 20 slices of 50 x 40 values with one component
+    QVector<hsize_t> dims = {20, 50, 40, 1};
+    QVector<int32_t> data(20 * 50 * 40);
+    for(int i = 0; i < data.size(); i++)
+    {
+      data[i] = i / 1000;
+    }
+
+    H5Lite::DatasetCreationOptions options;
+    options.deflateLevel = 5;
+    options.shuffle = true;
+    options.chunkBytes = 50 * 40 * sizeof(int32_t) * 4;
+    {
+      H5ScopedDatasetCreationOptions scopedOptions(options);
+      herr_t err = QH5Lite::writePointerDataset(file_id, "Chunked", dims.size(), dims.data(), data.data());
+      DREAM3D_REQUIRE(err >= 0);
+    }
+    herr_t err = QH5Lite::writePointerDataset(file_id, "Contiguous", dims.size(), dims.data(), data.data());
+    DREAM3D_REQUIRE(err >= 0);
+
+    // The chunked dataset holds 4 whole slices per chunk
+    hid_t did = H5Dopen(file_id, "Chunked", H5P_DEFAULT);
+    hid_t dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CHUNKED);
+    QVector<hsize_t> chunkDims(4, 0);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_chunk(dcpl, 4, chunkDims.data()), 4);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], 4);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], 50);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], 40);
+    DREAM3D_REQUIRE_EQUAL(chunkDims[3], 1);
+    DREAM3D_REQUIRE(H5Dget_storage_size(did) < data.size() * sizeof(int32_t));
+    H5Pclose(dcpl);
+    H5Dclose(did);
+
+    did = H5Dopen(file_id, "Contiguous", H5P_DEFAULT);
+    dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CONTIGUOUS);
+    H5Pclose(dcpl);
+    H5Dclose(did);
+
+    QVector<int32_t> readData(data.size());
+    err = QH5Lite::readPointerDataset(file_id, "Chunked", readData.data());
+    DREAM3D_REQUIRE(err >= 0);
+    DREAM3D_REQUIRE(readData == data);
+
+    err = H5Fclose(file_id);
+    DREAM3D_REQUIRE(err >= 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHyperslabRead()
+  {
+    hid_t file_id = H5Fcreate(UnitTest::H5LiteTest::FileName.toLatin1().data(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    DREAM3D_REQUIRE(file_id > 0);
+
+    // 10 slices of 8 x 6 values with 2 components
+    QVector<hsize_t> dims = {10, 8, 6, 2};
+    QVector<int32_t> data(10 * 8 * 6 * 2);
+    for(int i = 0; i < data.size(); i++)
+    {
+      data[i] = i;
+    }
+    herr_t err = QH5Lite::writePointerDataset(file_id, "Volume", dims.size(), dims.data(), data.data());
+    DREAM3D_REQUIRE(err >= 0);
+
+    QVector<hsize_t> offset = {3, 2, 1, 0};
+    QVector<hsize_t> count = {4, 5, 3, 2};
+    QVector<int32_t> slab(4 * 5 * 3 * 2, -1);
+    err = QH5Lite::readPointerDatasetHyperslab(file_id, "Volume", offset, count, slab.data());
+    DREAM3D_REQUIRE(err >= 0);
+    size_t idx = 0;
+    for(hsize_t z = 0; z < count[0]; z++)
+    {
+      for(hsize_t y = 0; y < count[1]; y++)
+      {
+        for(hsize_t x = 0; x < count[2]; x++)
+        {
+          for(hsize_t c = 0; c < count[3]; c++)
+          {
+            hsize_t srcIdx = (((z + offset[0]) * dims[1] + (y + offset[1])) * dims[2] + (x + offset[2])) * dims[3] + c;
+            DREAM3D_REQUIRE_EQUAL(slab[idx], data[srcIdx]);
+            idx++;
+          }
+        }
+      }
+    }
+
+    // A region that runs past the end of the dataset must fail
+    offset[0] = 8;
+    err = QH5Lite::readPointerDatasetHyperslab(file_id, "Volume", offset, count, slab.data());
+    DREAM3D_REQUIRE(err < 0);
+
+    err = H5Fclose(file_id);
+    DREAM3D_REQUIRE(err >= 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIOExecutor()
+  {
+    H5IOExecutor& executor = H5IOExecutor::Instance();
+    DREAM3D_REQUIRE(executor.isIOThread() == false)
+
+    hid_t file_id = executor.submit([] { return H5Utilities::createFile(UnitTest::H5LiteTest::FileName.toStdString()); }).get();
+    DREAM3D_REQUIRE(file_id > 0);
+
+    // The options of the submitting thread are used on the I/O thread
+    H5Lite::DatasetCreationOptions options;
+    options.deflateLevel = 1;
+    H5ScopedDatasetCreationOptions scopedOptions(options);
+
+    // Tasks run in the order they were submitted
+    std::vector<int32_t> order;
+    std::vector<std::future<herr_t>> writes;
+    for(int32_t i = 0; i < 8; i++)
+    {
+      writes.push_back(executor.submit([file_id, i, &order, &executor] {
+        order.push_back(i);
+        std::vector<int32_t> data(1000, i);
+        std::vector<hsize_t> dims(1, data.size());
+        std::string name = "Array_" + std::to_string(i);
+        // Submitting from the I/O thread runs the task right away
+        return executor.submit([&] { return H5Lite::writePointerDataset(file_id, name, 1, dims.data(), data.data()); }).get();
+      }));
+    }
+    for(std::future<herr_t>& write : writes)
+    {
+      DREAM3D_REQUIRE(write.get() >= 0);
+    }
+    executor.waitForIdle();
+    DREAM3D_REQUIRE(order.size() == 8)
+    for(int32_t i = 0; i < 8; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(order[i], i)
+    }
+
+    H5D_layout_t layout = executor.submit([file_id] {
+      // Raw HDF5 calls in a task lock the library themselves
+      std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
+      hid_t did = H5Dopen(file_id, "Array_3", H5P_DEFAULT);
+      hid_t dcpl = H5Dget_create_plist(did);
+      H5D_layout_t value = H5Pget_layout(dcpl);
+      H5Pclose(dcpl);
+      H5Dclose(did);
+      return value;
+    }).get();
+    DREAM3D_REQUIRE(layout == H5D_CHUNKED)
+
+    std::vector<int32_t> data;
+    herr_t err = executor.submit([file_id, &data] { return H5Lite::readVectorDataset(file_id, "Array_7", data); }).get();
+    DREAM3D_REQUIRE(err >= 0);
+    DREAM3D_REQUIRE(data.size() == 1000)
+    DREAM3D_REQUIRE_EQUAL(data[999], 7)
+
+    // A running task does not hold the library mutex, so other threads can make H5Support calls
+    // between the calls of a long task
+    std::promise<void> taskStarted;
+    std::promise<void> releaseTask;
+    std::shared_future<void> release = releaseTask.get_future().share();
+    std::future<herr_t> longTask = executor.submit([file_id, &taskStarted, release] {
+      taskStarted.set_value();
+      release.wait();
+      int32_t value = 1;
+      return H5Lite::writeScalarDataset(file_id, "LongTask", value);
+    });
+    taskStarted.get_future().wait();
+    bool locked = H5Lite::GetLibraryMutex().try_lock();
+    DREAM3D_REQUIRE(locked)
+    H5Lite::GetLibraryMutex().unlock();
+    DREAM3D_REQUIRE(H5Lite::datasetExists(file_id, "Array_0"))
+    releaseTask.set_value();
+    DREAM3D_REQUIRE(longTask.get() >= 0);
+
+    err = executor.submit([&file_id] { return H5Utilities::closeFile(file_id); }).get();
+    DREAM3D_REQUIRE(err >= 0);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1450,6 +1675,9 @@ public:
 
     DREAM3D_REGISTER_TEST(TestTypeDetection())
     DREAM3D_REGISTER_TEST(QH5LiteTest())
+    DREAM3D_REGISTER_TEST(TestChunkedDataset())
+    DREAM3D_REGISTER_TEST(TestHyperslabRead())
+    DREAM3D_REGISTER_TEST(TestIOExecutor())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
@@ -53,6 +53,7 @@
 
 // DREAM3DLib includes
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -92,11 +93,29 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  // An option that caps the threads used by the parallel algorithms (-t)
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads used by the parallel algorithms. 0 uses every core.", "count");
+  parser.addOption(threadsArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
 
+  if(parser.isSet(threadsArg))
+  {
+    bool ok = false;
+    int numThreads = parser.value(threadsArg).toInt(&ok);
+    if(!ok || numThreads < 0)
+    {
+      std::cout << "The thread count '" << parser.value(threadsArg).toStdString() << "' is not a valid number of threads" << std::endl;
+      return EXIT_FAILURE;
+    }
+    ExecutionContext::SetMaxThreads(numThreads);
+  }
+
   std::cout << "PipelineRunner Starting. " << std::endl;
   std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
 
@@ -0,0 +1,164 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ExecutionContext.h"
+
+#include <memory>
+
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+namespace
+{
+/**
+ * @brief The process wide state behind ExecutionContext
+ */
+struct ExecutionState
+{
+  ExecutionState()
+  {
+    bool ok = false;
+    int numThreads = qgetenv("SIMPL_NUM_THREADS").toInt(&ok);
+    if(ok && numThreads > 0)
+    {
+      m_MaxThreads = numThreads;
+    }
+  }
+
+  QMutex m_Mutex;
+  int m_MaxThreads = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  std::shared_ptr<tbb::task_arena> m_Arena;
+#endif
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExecutionState& GetExecutionState()
+{
+  static ExecutionState state;
+  return state;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExecutionContext::ExecutionContext() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ExecutionContext::~ExecutionContext() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ExecutionContext::SetMaxThreads(int numThreads)
+{
+  ExecutionState& state = GetExecutionState();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // Declared before the locker so that the old arena is released after the mutex is unlocked
+  std::shared_ptr<tbb::task_arena> oldArena;
+#endif
+  QMutexLocker locker(&state.m_Mutex);
+  int maxThreads = (numThreads > 0) ? numThreads : 0;
+  if(maxThreads == state.m_MaxThreads)
+  {
+    return;
+  }
+  state.m_MaxThreads = maxThreads;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // The arena is created again with the new concurrency the next time it is needed. Callers that are
+  // still inside Execute() hold their own reference, so the old arena lives until they return.
+  oldArena.swap(state.m_Arena);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExecutionContext::GetMaxThreads()
+{
+  ExecutionState& state = GetExecutionState();
+  QMutexLocker locker(&state.m_Mutex);
+  return state.m_MaxThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ExecutionContext::GetNumThreads()
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  int numCores = QThread::idealThreadCount();
+  if(numCores < 1)
+  {
+    numCores = 1;
+  }
+  int maxThreads = GetMaxThreads();
+  return (maxThreads > 0) ? maxThreads : numCores;
+#else
+  return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ExecutionContext::IsParallel()
+{
+  return GetNumThreads() > 1;
+}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::shared_ptr<tbb::task_arena> ExecutionContext::GetTaskArena()
+{
+  int numCores = QThread::idealThreadCount();
+  ExecutionState& state = GetExecutionState();
+  QMutexLocker locker(&state.m_Mutex);
+  if(nullptr == state.m_Arena)
+  {
+    int numThreads = (state.m_MaxThreads > 0) ? state.m_MaxThreads : numCores;
+    state.m_Arena = std::make_shared<tbb::task_arena>(numThreads < 1 ? 1 : numThreads);
+  }
+  return state.m_Arena;
+}
+#endif
@@ -0,0 +1,115 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
+/**
+ * @brief The ExecutionContext class holds the process wide settings for the parallel algorithms in
+ * SIMPLib. Every parallel algorithm runs its TBB loops through Execute(), which places them in a
+ * single task arena whose concurrency is GetNumThreads(). Capping the threads lets several
+ * pipelines share a machine without oversubscribing its cores.
+ *
+ * The initial thread count comes from the SIMPL_NUM_THREADS environment variable. When it is not
+ * set, or is 0, every core of the machine is used.
+ */
+class SIMPLib_EXPORT ExecutionContext
+{
+  public:
+    virtual ~ExecutionContext();
+
+    /**
+     * @brief Sets the largest number of threads that the parallel algorithms may use. A value of
+     * 0 or less uses every core of the machine. Work that is already running inside Execute()
+     * finishes in the arena it started in; later calls to Execute() use the new limit.
+     * @param numThreads
+     */
+    static void SetMaxThreads(int numThreads);
+
+    /**
+     * @brief Returns the thread limit that was set, or 0 if every core is used
+     * @return
+     */
+    static int GetMaxThreads();
+
+    /**
+     * @brief Returns the number of threads that the parallel algorithms will actually use
+     * @return
+     */
+    static int GetNumThreads();
+
+    /**
+     * @brief Returns true if the parallel algorithms are compiled in and may use more than one thread
+     * @return
+     */
+    static bool IsParallel();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    /**
+     * @brief Runs func inside the SIMPLib task arena so that any TBB algorithm it starts uses at
+     * most GetNumThreads() threads. The call returns once func has completed.
+     * @param func
+     */
+    template <typename Func> static void Execute(const Func& func)
+    {
+      // Holding a reference keeps the arena alive if SetMaxThreads() replaces it while func runs
+      std::shared_ptr<tbb::task_arena> arena = GetTaskArena();
+      arena->execute(func);
+    }
+
+    /**
+     * @brief Returns the task arena that Execute() uses. The arena stays valid for as long as the
+     * returned pointer is held, even if SetMaxThreads() replaces it in the meantime.
+     * @return
+     */
+    static std::shared_ptr<tbb::task_arena> GetTaskArena();
+#endif
+
+  protected:
+    ExecutionContext();
+
+  public:
+    ExecutionContext(const ExecutionContext&) = delete;            // Copy Constructor Not Implemented
+    ExecutionContext(ExecutionContext&&) = delete;                 // Move Constructor Not Implemented
+    ExecutionContext& operator=(const ExecutionContext&) = delete; // Copy Assignment Not Implemented
+    ExecutionContext& operator=(ExecutionContext&&) = delete;      // Move Assignment Not Implemented
+};
@@ -22,6 +22,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Constants.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CreatedArrayHelpIndexEntry.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ExecutionContext.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IObserver.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhaseType.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineMessage.h
@@ -39,6 +40,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CreatedArrayHelpIndexEntry.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DocRequestManager.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/EnsembleInfo.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ExecutionContext.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IObserver.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Observable.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Observer.cpp
@@ -63,3 +65,11 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
 )
 
 
+
+#-------------------------------------------------------------------------------
+# Add the unit testing sources
+# --------------------------------------------------------------------
+# If Testing is enabled, turn on the Unit Tests
+if(SIMPL_BUILD_TESTING)
+  include(${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx/SourceList.cmake)
+endif()
@@ -0,0 +1,149 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <atomic>
+#include <thread>
+
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ExecutionContextTest
+{
+public:
+  ExecutionContextTest() = default;
+  virtual ~ExecutionContextTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMaxThreads()
+  {
+    int maxThreads = ExecutionContext::GetMaxThreads();
+
+    ExecutionContext::SetMaxThreads(3);
+    DREAM3D_REQUIRE_EQUAL(ExecutionContext::GetMaxThreads(), 3)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    DREAM3D_REQUIRE_EQUAL(ExecutionContext::GetNumThreads(), 3)
+    DREAM3D_REQUIRE_EQUAL(ExecutionContext::GetTaskArena()->max_concurrency(), 3)
+#endif
+
+    ExecutionContext::SetMaxThreads(-1);
+    DREAM3D_REQUIRE_EQUAL(ExecutionContext::GetMaxThreads(), 0)
+    DREAM3D_REQUIRE(ExecutionContext::GetNumThreads() >= 1)
+
+    ExecutionContext::SetMaxThreads(maxThreads);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSetMaxThreadsDuringExecute()
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    int maxThreads = ExecutionContext::GetMaxThreads();
+    ExecutionContext::SetMaxThreads(2);
+
+    const size_t numValues = 1000000;
+    std::atomic<bool> running(false);
+    std::atomic<bool> changed(false);
+    std::atomic<size_t> sum(0);
+
+    // Replace the arena several times while another thread is inside Execute()
+    std::thread worker([&] {
+      ExecutionContext::Execute([&] {
+        running = true;
+        while(!changed)
+        {
+          std::this_thread::yield();
+        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numValues, 1000), [&](const tbb::blocked_range<size_t>& r) {
+          size_t localSum = 0;
+          for(size_t i = r.begin(); i < r.end(); i++)
+          {
+            localSum += i;
+          }
+          sum += localSum;
+        });
+      });
+    });
+
+    while(!running)
+    {
+      std::this_thread::yield();
+    }
+    ExecutionContext::SetMaxThreads(3);
+    ExecutionContext::SetMaxThreads(0);
+    ExecutionContext::SetMaxThreads(4);
+    changed = true;
+    worker.join();
+    DREAM3D_REQUIRE_EQUAL(sum.load(), numValues * (numValues - 1) / 2)
+
+    // New work runs in the arena created for the new limit
+    DREAM3D_REQUIRE_EQUAL(ExecutionContext::GetTaskArena()->max_concurrency(), 4)
+    sum = 0;
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numValues, 1000), [&](const tbb::blocked_range<size_t>& r) { sum += r.size(); });
+    });
+    DREAM3D_REQUIRE_EQUAL(sum.load(), numValues)
+
+    ExecutionContext::SetMaxThreads(maxThreads);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ExecutionContextTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestMaxThreads());
+    DREAM3D_REGISTER_TEST(TestSetMaxThreadsDuringExecute());
+  }
+
+private:
+  ExecutionContextTest(const ExecutionContextTest&); // Copy Constructor Not Implemented
+  void operator=(const ExecutionContextTest&);       // Move assignment Not Implemented
+};
@@ -54,6 +54,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorKernel.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -279,7 +280,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if (item1->isArray())
       {
-        if (cDims.isEmpty() == false && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if (cDims.isEmpty() == false && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getSourceArray()->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS));
@@ -288,12 +289,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getSourceArray()->getComponentDimensions();
       }
       else if (resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getSourceArray()->getComponentDimensions();
       }
     }
   }
@@ -414,6 +415,24 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
+  // Evaluate the whole expression in a single pass when the kernel supports every item in it
+  CalculatorKernel kernel;
+  if(kernel.compile(rpn, m_Units == Degrees))
+  {
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Expression");
+
+    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+    IDataArray::Pointer resultArray = kernel.execute(m_ScalarType, m_CalculatedArray.getDataArrayName());
+    if(nullptr != createdAM && nullptr != resultArray)
+    {
+      createdAM->addAttributeArray(resultArray->getName(), resultArray);
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
   // Execute the RPN expression
   int totalItems = rpn.size();
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
@@ -853,9 +872,9 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  if(nullptr != calcArray && index >= calcArray->getSourceArray()->getNumberOfComponents())
   {
-    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
+    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getSourceArray()->getName());
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return false;
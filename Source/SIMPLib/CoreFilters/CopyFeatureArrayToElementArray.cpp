@@ -35,8 +35,19 @@
 
 #include "CopyFeatureArrayToElementArray.h"
 
+#include <algorithm>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/FeatureDataView.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
@@ -154,10 +165,90 @@ void CopyFeatureArrayToElementArray::preflight()
   setInPreflight(false);
 }
 
+/**
+ * @brief The FeatureIdRangeImpl class finds the smallest and largest Feature Id so that the ids
+ * can be validated before anything is allocated or copied.
+ */
+class FeatureIdRangeImpl
+{
+  const int32_t* m_FeatureIds;
+
+public:
+  int32_t m_SmallestFeature = 0;
+  int32_t m_LargestFeature = 0;
+
+  FeatureIdRangeImpl(const int32_t* featureIds)
+  : m_FeatureIds(featureIds)
+  {
+  }
+
+  void compute(size_t start, size_t end)
+  {
+    int32_t smallest = m_SmallestFeature;
+    int32_t largest = m_LargestFeature;
+    for(size_t i = start; i < end; i++)
+    {
+      smallest = std::min(smallest, m_FeatureIds[i]);
+      largest = std::max(largest, m_FeatureIds[i]);
+    }
+    m_SmallestFeature = smallest;
+    m_LargestFeature = largest;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  FeatureIdRangeImpl(FeatureIdRangeImpl& other, tbb::split)
+  : m_FeatureIds(other.m_FeatureIds)
+  {
+  }
+
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
+
+  void join(const FeatureIdRangeImpl& rhs)
+  {
+    m_SmallestFeature = std::min(m_SmallestFeature, rhs.m_SmallestFeature);
+    m_LargestFeature = std::max(m_LargestFeature, rhs.m_LargestFeature);
+  }
+#endif
+};
+
+/**
+ * @brief The CopyFeatureDataImpl class gathers the Feature tuples into the Element array. The
+ * Feature Ids must already have been validated.
+ */
+template <typename T> class CopyFeatureDataImpl
+{
+  const FeatureDataView<T>* m_View;
+  T* m_Destination;
+  size_t m_NumComp;
+
+public:
+  CopyFeatureDataImpl(const FeatureDataView<T>* view, T* destination)
+  : m_View(view)
+  , m_Destination(destination)
+  , m_NumComp(static_cast<size_t>(view->getNumberOfComponents()))
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    m_View->gather(start, end, m_Destination + start * m_NumComp);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints, int32_t* featureIds)
+template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData, Int32ArrayType::Pointer featureIds)
 {
   QString cellArrayName = inputData->getName();
 
@@ -167,27 +258,25 @@ template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData
     return IDataArray::NullPointer();
   }
 
+  size_t totalPoints = featureIds->getNumberOfTuples();
   QVector<size_t> cDims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName);
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
+  FeatureDataView<T> view(feature, featureIds);
+  CopyFeatureDataImpl<T> impl(&view, cell->getPointer(0));
 
-  int32_t numComp = feature->getNumberOfComponents();
-  int32_t featureIdx = 0;
-
-  for(size_t i = 0; i < totalPoints; ++i)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+  if(doParallel)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), impl, tbb::auto_partitioner()); });
+  }
+  else
+#endif
+  {
+    impl.compute(0, totalPoints);
   }
+
   return cell;
 }
 
@@ -204,36 +293,44 @@ void CopyFeatureArrayToElementArray::execute()
     return;
   }
 
-  // Validate that the selected InArray has tuples equal to the largest
-  // Feature Id; the filter would not crash otherwise, but the user should
-  // be notified of unanticipated behavior ; this cannot be done in the dataCheck since
-  // we don't have acces to the data yet
+  // Validate that every Feature Id is a tuple of the selected InArray and that the largest id is
+  // its last tuple before the Element array is allocated. The filter would not crash on the last
+  // check, but the user should be notified of unanticipated behavior; this cannot be done in the
+  // dataCheck since we don't have acces to the data yet
   int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
+  Int32ArrayType::Pointer featureIds = m_FeatureIdsPtr.lock();
+  size_t totalPoints = featureIds->getNumberOfTuples();
+  FeatureIdRangeImpl range(featureIds->getPointer(0));
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+  if(doParallel)
   {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
+    ExecutionContext::Execute([&] { tbb::parallel_reduce(tbb::blocked_range<size_t>(0, totalPoints), range, tbb::auto_partitioner()); });
+  }
+  else
+#endif
+  {
+    range.compute(0, totalPoints);
   }
 
-  if(mismatchedFeatures == true)
+  if(range.m_SmallestFeature < 0)
   {
-    QString ss = QObject::tr("The largest Feature Id (%1) in the FeatureIds array is larger than the number of Features in the InArray array (%2)").arg(largestFeature).arg(numFeatures);
+    QString ss = QObject::tr("The FeatureIds array contains a negative Feature Id (%1)").arg(range.m_SmallestFeature);
+    setErrorCondition(-5557);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  if(range.m_LargestFeature >= numFeatures)
+  {
+    QString ss = QObject::tr("The largest Feature Id (%1) in the FeatureIds array is larger than the number of Features in the InArray array (%2)").arg(range.m_LargestFeature).arg(numFeatures);
     setErrorCondition(-5555);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
 
-  if(largestFeature != (numFeatures - 1))
+  if(range.m_LargestFeature != (numFeatures - 1))
   {
     QString ss = QObject::tr("The number of Features in the InArray array (%1) does not match the largest Feature Id in the FeatureIds array").arg(numFeatures);
     setErrorCondition(-5555);
@@ -245,53 +342,54 @@ void CopyFeatureArrayToElementArray::execute()
 
   if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int8_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint8_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int16_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint16_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int32_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint32_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int64_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint64_t>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<float>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<float>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<double>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<double>(m_InArrayPtr.lock(), featureIds);
   }
   else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<bool>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<bool>(m_InArrayPtr.lock(), featureIds);
   }
   else
   {
     QString ss = QObject::tr("The selected array was of unsupported type. The path is %1").arg(m_SelectedFeatureArrayPath.serialize());
     setErrorCondition(-14000);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
   }
 
   if(p.get() != nullptr)
@@ -35,10 +35,24 @@
 
 #include "CreateFeatureArrayFromElementArray.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -52,6 +66,7 @@ CreateFeatureArrayFromElementArray::CreateFeatureArrayFromElementArray()
 , m_SelectedCellArrayPath("", "", "")
 , m_CreatedArrayName("")
 , m_FeatureIdsArrayPath("", "", "")
+, m_ReductionType(LastValue)
 , m_FeatureIds(nullptr)
 {
 }
@@ -73,6 +88,16 @@ void CreateFeatureArrayFromElementArray::setupFilterParameters()
         DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Category::Element);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Element Data to Copy to Feature Data", SelectedCellArrayPath, FilterParameter::RequiredArray, CreateFeatureArrayFromElementArray, req));
   }
+  {
+    QVector<QString> choices;
+    choices.push_back("Last Value");
+    choices.push_back("First Value");
+    choices.push_back("Mean");
+    choices.push_back("Minimum");
+    choices.push_back("Maximum");
+    choices.push_back("Mode");
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Reduction", ReductionType, FilterParameter::Parameter, CreateFeatureArrayFromElementArray, choices, false));
+  }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Element);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::RequiredArray, CreateFeatureArrayFromElementArray, req));
@@ -96,6 +121,7 @@ void CreateFeatureArrayFromElementArray::readFilterParameters(AbstractFilterPara
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setCreatedArrayName(reader->readString("CreatedArrayName", getCreatedArrayName()));
+  setReductionType(reader->readValue("ReductionType", getReductionType()));
   reader->closeFilterGroup();
 }
 
@@ -133,6 +159,13 @@ void CreateFeatureArrayFromElementArray::dataCheck()
 
   getDataContainerArray()->getPrereqAttributeMatrixFromPath<AbstractFilter>(this, getCellFeatureAttributeMatrixName(), -301);
 
+  if(getReductionType() < LastValue || getReductionType() > Mode)
+  {
+    QString ss = QObject::tr("The reduction type (%1) must be between %2 and %3").arg(getReductionType()).arg(LastValue).arg(Mode);
+    setErrorCondition(-11003);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+
   if(getErrorCondition() < 0)
   {
     return;
@@ -155,171 +188,504 @@ void CreateFeatureArrayFromElementArray::preflight()
   setInPreflight(false);
 }
 
+namespace
+{
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName)
+template <typename T> typename std::enable_if<std::is_floating_point<T>::value, T>::type MeanToValue(double mean)
 {
-  QString featureArrayName = inputData->getName();
+  return static_cast<T>(mean);
+}
 
-  typename DataArray<T>::Pointer cell = std::dynamic_pointer_cast<DataArray<T>>(inputData);
-  if(nullptr == cell)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> typename std::enable_if<!std::is_floating_point<T>::value, T>::type MeanToValue(double mean)
+{
+  return static_cast<T>(std::round(mean));
+}
+} // namespace
+
+/**
+ * @brief The FeatureReductionImpl class combines the Element values of every Feature for all of
+ * the reductions except the mode. Each body of the parallel reduction accumulates into its own
+ * Feature sized buffers, which join() merges. Elements with an invalid Feature Id are skipped; the
+ * caller reports them from the smallest and largest ids.
+ */
+template <typename T> class FeatureReductionImpl
+{
+  const T* m_Cells;
+  const int32_t* m_FeatureIds;
+  size_t m_NumComp;
+  int32_t m_NumFeatures;
+  int m_ReductionType;
+
+public:
+  std::vector<T> m_Values;
+  std::vector<double> m_Sums;
+  std::vector<size_t> m_Counts;
+  std::vector<size_t> m_Indices;
+  int32_t m_SmallestFeature = 0;
+  int32_t m_LargestFeature = 0;
+  int32_t m_InconsistentFeature = -1;
+
+  FeatureReductionImpl(const T* cells, const int32_t* featureIds, size_t numComp, int32_t numFeatures, int reductionType)
+  : m_Cells(cells)
+  , m_FeatureIds(featureIds)
+  , m_NumComp(numComp)
+  , m_NumFeatures(numFeatures)
+  , m_ReductionType(reductionType)
   {
-    return IDataArray::NullPointer();
+    allocate();
   }
 
-  QVector<size_t> dims = inputData->getComponentDimensions();
-  typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName);
+  void allocate()
+  {
+    size_t numFeatures = static_cast<size_t>(m_NumFeatures);
+    m_Counts.assign(numFeatures, 0);
+    if(m_ReductionType == CreateFeatureArrayFromElementArray::Mean)
+    {
+      m_Sums.assign(numFeatures * m_NumComp, 0.0);
+    }
+    else
+    {
+      m_Values.assign(numFeatures * m_NumComp, static_cast<T>(0));
+    }
+    if(m_ReductionType == CreateFeatureArrayFromElementArray::LastValue || m_ReductionType == CreateFeatureArrayFromElementArray::FirstValue)
+    {
+      m_Indices.assign(numFeatures, 0);
+    }
+  }
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
+  /**
+   * @brief Folds count Elements whose combined value is src, and whose first or last Element is
+   * index, into Feature f
+   */
+  void combine(size_t f, const T* src, size_t index, size_t count)
+  {
+    T* dst = m_Values.data() + f * m_NumComp;
+    if(m_Counts[f] == 0)
+    {
+      std::copy(src, src + m_NumComp, dst);
+      if(!m_Indices.empty())
+      {
+        m_Indices[f] = index;
+      }
+      m_Counts[f] = count;
+      return;
+    }
+    m_Counts[f] += count;
 
-  int32_t numComp = cell->getNumberOfComponents();
-  int32_t featureIdx = 0;
+    switch(m_ReductionType)
+    {
+    case CreateFeatureArrayFromElementArray::Minimum:
+      for(size_t c = 0; c < m_NumComp; c++)
+      {
+        dst[c] = std::min(dst[c], src[c]);
+      }
+      break;
+    case CreateFeatureArrayFromElementArray::Maximum:
+      for(size_t c = 0; c < m_NumComp; c++)
+      {
+        dst[c] = std::max(dst[c], src[c]);
+      }
+      break;
+    default:
+    {
+      if(!std::equal(src, src + m_NumComp, dst) && (m_InconsistentFeature < 0 || static_cast<int32_t>(f) < m_InconsistentFeature))
+      {
+        m_InconsistentFeature = static_cast<int32_t>(f);
+      }
+      bool replace = (m_ReductionType == CreateFeatureArrayFromElementArray::LastValue) ? (index > m_Indices[f]) : (index < m_Indices[f]);
+      if(replace)
+      {
+        std::copy(src, src + m_NumComp, dst);
+        m_Indices[f] = index;
+      }
+    }
+    break;
+    }
+  }
 
-  size_t cells = inputData->getNumberOfTuples();
+  void compute(size_t start, size_t end)
+  {
+    bool mean = (m_ReductionType == CreateFeatureArrayFromElementArray::Mean);
+    for(size_t i = start; i < end; i++)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      m_SmallestFeature = std::min(m_SmallestFeature, featureId);
+      m_LargestFeature = std::max(m_LargestFeature, featureId);
+      if(featureId < 0 || featureId >= m_NumFeatures)
+      {
+        continue;
+      }
+      size_t f = static_cast<size_t>(featureId);
+      const T* src = m_Cells + i * m_NumComp;
+      if(mean)
+      {
+        double* sum = m_Sums.data() + f * m_NumComp;
+        for(size_t c = 0; c < m_NumComp; c++)
+        {
+          sum[c] += static_cast<double>(src[c]);
+        }
+        m_Counts[f]++;
+      }
+      else
+      {
+        combine(f, src, i, 1);
+      }
+    }
+  }
 
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
+  void finish(T* output) const
+  {
+    size_t numFeatures = static_cast<size_t>(m_NumFeatures);
+    if(m_ReductionType != CreateFeatureArrayFromElementArray::Mean)
+    {
+      std::copy(m_Values.begin(), m_Values.end(), output);
+      return;
+    }
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      for(size_t c = 0; c < m_NumComp; c++)
+      {
+        size_t idx = f * m_NumComp + c;
+        output[idx] = (m_Counts[f] == 0) ? static_cast<T>(0) : MeanToValue<T>(m_Sums[idx] / static_cast<double>(m_Counts[f]));
+      }
+    }
+  }
 
-  for(size_t i = 0; i < cells; ++i)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  FeatureReductionImpl(FeatureReductionImpl& other, tbb::split)
+  : m_Cells(other.m_Cells)
+  , m_FeatureIds(other.m_FeatureIds)
+  , m_NumComp(other.m_NumComp)
+  , m_NumFeatures(other.m_NumFeatures)
+  , m_ReductionType(other.m_ReductionType)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
+    allocate();
+  }
 
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
 
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
+  void join(const FeatureReductionImpl& rhs)
+  {
+    m_SmallestFeature = std::min(m_SmallestFeature, rhs.m_SmallestFeature);
+    m_LargestFeature = std::max(m_LargestFeature, rhs.m_LargestFeature);
+    if(rhs.m_InconsistentFeature >= 0 && (m_InconsistentFeature < 0 || rhs.m_InconsistentFeature < m_InconsistentFeature))
     {
-      featureMap.insert(featureIdx, cSourcePtr);
+      m_InconsistentFeature = rhs.m_InconsistentFeature;
     }
 
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
+    size_t numFeatures = static_cast<size_t>(m_NumFeatures);
+    for(size_t f = 0; f < numFeatures; f++)
     {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
+      if(rhs.m_Counts[f] == 0)
+      {
+        continue;
+      }
+      if(m_ReductionType == CreateFeatureArrayFromElementArray::Mean)
       {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        filter->setWarningCondition(-1000);
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
-        warningThrown = true;
+        for(size_t c = 0; c < m_NumComp; c++)
+        {
+          m_Sums[f * m_NumComp + c] += rhs.m_Sums[f * m_NumComp + c];
+        }
+        m_Counts[f] += rhs.m_Counts[f];
+      }
+      else
+      {
+        combine(f, rhs.m_Values.data() + f * m_NumComp, rhs.m_Indices.empty() ? 0 : rhs.m_Indices[f], rhs.m_Counts[f]);
       }
     }
+  }
+#endif
+};
+
+/**
+ * @brief The FeatureModeImpl class finds the most frequent value of each component of a range of
+ * Features. The Elements are grouped by Feature beforehand so each Feature is handled by one task.
+ */
+template <typename T> class FeatureModeImpl
+{
+  // std::vector<bool> can not be sorted in place
+  using ValueType = typename std::conditional<std::is_same<T, bool>::value, uint8_t, T>::type;
+
+  const T* m_Cells;
+  size_t m_NumComp;
+  const std::vector<size_t>& m_Offsets;
+  const std::vector<size_t>& m_Elements;
+  T* m_Output;
+
+public:
+  FeatureModeImpl(const T* cells, size_t numComp, const std::vector<size_t>& offsets, const std::vector<size_t>& elements, T* output)
+  : m_Cells(cells)
+  , m_NumComp(numComp)
+  , m_Offsets(offsets)
+  , m_Elements(elements)
+  , m_Output(output)
+  {
+  }
 
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<ValueType> values;
+    for(size_t f = start; f < end; f++)
+    {
+      size_t first = m_Offsets[f];
+      size_t last = m_Offsets[f + 1];
+      for(size_t c = 0; c < m_NumComp; c++)
+      {
+        if(first == last)
+        {
+          m_Output[f * m_NumComp + c] = static_cast<T>(0);
+          continue;
+        }
+        values.clear();
+        for(size_t e = first; e < last; e++)
+        {
+          values.push_back(static_cast<ValueType>(m_Cells[m_Elements[e] * m_NumComp + c]));
+        }
+        std::sort(values.begin(), values.end());
+
+        // Runs of equal values are adjacent, and only a strictly longer run replaces the best one
+        ValueType best = values[0];
+        size_t bestCount = 0;
+        for(size_t run = 0; run < values.size();)
+        {
+          size_t next = run + 1;
+          while(next < values.size() && values[next] == values[run])
+          {
+            next++;
+          }
+          if(next - run > bestCount)
+          {
+            best = values[run];
+            bestCount = next - run;
+          }
+          run = next;
+        }
+        m_Output[f * m_NumComp + c] = static_cast<T>(best);
+      }
+    }
+  }
 
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
   }
-  return feature;
-}
+#endif
+};
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void CreateFeatureArrayFromElementArray::execute()
+template <typename T>
+void computeFeatureMode(const T* cells, size_t numComp, const int32_t* featureIds, size_t totalPoints, int32_t numFeatures, T* output, int32_t& smallestFeature, int32_t& largestFeature)
 {
-  setErrorCondition(0);
-  setWarningCondition(0);
-  dataCheck();
-  if(getErrorCondition() < 0)
+  // Group the Element indices by Feature with a counting sort
+  std::vector<size_t> offsets(static_cast<size_t>(numFeatures) + 1, 0);
+  for(size_t i = 0; i < totalPoints; i++)
+  {
+    int32_t featureId = featureIds[i];
+    smallestFeature = std::min(smallestFeature, featureId);
+    largestFeature = std::max(largestFeature, featureId);
+    if(featureId >= 0 && featureId < numFeatures)
+    {
+      offsets[static_cast<size_t>(featureId) + 1]++;
+    }
+  }
+  if(smallestFeature < 0 || largestFeature >= numFeatures)
   {
     return;
   }
-
-  // Validate that the selected InArray has tuples equal to the largest
-  // Feature Id; the filter would not crash otherwise, but the user should
-  // be notified of unanticipated behavior ; this cannot be done in the dataCheck since
-  // we don't have acces to the data yet
-  int32_t totalFeatures = getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->getNumberOfTuples();
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  for(size_t f = 0; f < static_cast<size_t>(numFeatures); f++)
+  {
+    offsets[f + 1] += offsets[f];
+  }
+  std::vector<size_t> elements(totalPoints);
+  std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
   for(size_t i = 0; i < totalPoints; i++)
   {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= totalFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
+    elements[cursor[static_cast<size_t>(featureIds[i])]++] = i;
   }
 
-  if(mismatchedFeatures == true)
+  FeatureModeImpl<T> impl(cells, numComp, offsets, elements, output);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+  if(doParallel)
   {
-    QString ss = QObject::tr("Attribute Matrix %1 has %2 tuples but the input array %3 has a Feature ID value of at least %4").arg(m_CellFeatureAttributeMatrixName.serialize("/")).arg(totalFeatures).arg(getFeatureIdsArrayPath().serialize("/")).arg(largestFeature);
-    setErrorCondition(-5555);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(numFeatures)), impl, tbb::auto_partitioner()); });
   }
+  else
+#endif
+  {
+    impl.compute(0, static_cast<size_t>(numFeatures));
+  }
+}
 
-  if(largestFeature != (totalFeatures - 1))
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, Int32ArrayType::Pointer featureIds, const QString& createdArrayName, int reductionType,
+                                 int32_t& smallestFeature, int32_t& largestFeature)
+{
+  typename DataArray<T>::Pointer cell = std::dynamic_pointer_cast<DataArray<T>>(inputData);
+  if(nullptr == cell)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  QVector<size_t> dims = inputData->getComponentDimensions();
+  typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName);
+
+  T* fPtr = feature->getPointer(0);
+  T* cPtr = cell->getPointer(0);
+  size_t numComp = static_cast<size_t>(cell->getNumberOfComponents());
+  size_t totalPoints = featureIds->getNumberOfTuples();
+  smallestFeature = 0;
+  largestFeature = 0;
+
+  if(reductionType == CreateFeatureArrayFromElementArray::Mode)
+  {
+    computeFeatureMode<T>(cPtr, numComp, featureIds->getPointer(0), totalPoints, features, fPtr, smallestFeature, largestFeature);
+    return feature;
+  }
+
+  FeatureReductionImpl<T> impl(cPtr, featureIds->getPointer(0), numComp, features, reductionType);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+  if(doParallel)
+  {
+    ExecutionContext::Execute([&] { tbb::parallel_reduce(tbb::blocked_range<size_t>(0, totalPoints), impl, tbb::auto_partitioner()); });
+  }
+  else
+#endif
+  {
+    impl.compute(0, totalPoints);
+  }
+  smallestFeature = impl.m_SmallestFeature;
+  largestFeature = impl.m_LargestFeature;
+  if(smallestFeature < 0 || largestFeature >= features)
+  {
+    return feature;
+  }
+  impl.finish(fPtr);
+
+  if(impl.m_InconsistentFeature >= 0)
+  {
+    // The values are inconsistent with the copied values for this feature id, so throw a warning
+    QString which = (reductionType == CreateFeatureArrayFromElementArray::FirstValue) ? "first" : "last";
+    filter->setWarningCondition(-1000);
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The %2 value copied into Feature %1 will be used").arg(impl.m_InconsistentFeature).arg(which);
+    filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
+  }
+  return feature;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CreateFeatureArrayFromElementArray::execute()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0)
   {
-    QString ss = QObject::tr("The number of Features in the InArray array (%1) does not match the largest Feature Id in the FeatureIds array").arg(totalFeatures);
-    setErrorCondition(-5556);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
 
+  // The Feature Ids are validated while the Element values are combined: every id must be a tuple
+  // of the Feature Attribute Matrix and the largest id should be its last tuple. The filter would
+  // not crash otherwise, but the user should be notified of unanticipated behavior; this cannot be
+  // done in the dataCheck since we don't have acces to the data yet
+  int32_t totalFeatures = getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->getNumberOfTuples();
+  int32_t smallestFeature = 0;
+  int32_t largestFeature = 0;
+  Int32ArrayType::Pointer featureIds = m_FeatureIdsPtr.lock();
+
   IDataArray::Pointer p = IDataArray::NullPointer();
 
   if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<float>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<float>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<double>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<double>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<bool>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<bool>(this, m_InArrayPtr.lock(), totalFeatures, featureIds, getCreatedArrayName(), getReductionType(), smallestFeature, largestFeature);
   }
   else
   {
     QString ss = QObject::tr("The selected array was of unsupported type. The path is %1").arg(m_SelectedCellArrayPath.serialize());
     setErrorCondition(-14000);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  if(smallestFeature < 0)
+  {
+    QString ss = QObject::tr("The input array %1 has a negative Feature ID value (%2)").arg(getFeatureIdsArrayPath().serialize("/")).arg(smallestFeature);
+    setErrorCondition(-5557);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  if(largestFeature >= totalFeatures)
+  {
+    QString ss = QObject::tr("Attribute Matrix %1 has %2 tuples but the input array %3 has a Feature ID value of at least %4").arg(m_CellFeatureAttributeMatrixName.serialize("/")).arg(totalFeatures).arg(getFeatureIdsArrayPath().serialize("/")).arg(largestFeature);
+    setErrorCondition(-5555);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  if(largestFeature != (totalFeatures - 1))
+  {
+    QString ss = QObject::tr("The number of Features in the InArray array (%1) does not match the largest Feature Id in the FeatureIds array").arg(totalFeatures);
+    setErrorCondition(-5556);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
   }
 
   if(p.get() != nullptr)
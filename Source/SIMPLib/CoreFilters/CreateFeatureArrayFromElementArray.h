@@ -51,6 +51,7 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
     PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
     PYB11_PROPERTY(QString CreatedArrayName READ getCreatedArrayName WRITE setCreatedArrayName)
     PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+    PYB11_PROPERTY(int ReductionType READ getReductionType WRITE setReductionType)
 
   public:
     SIMPL_SHARED_POINTERS(CreateFeatureArrayFromElementArray)
@@ -71,6 +72,22 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, FeatureIdsArrayPath)
     Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
 
+    SIMPL_FILTER_PARAMETER(int, ReductionType)
+    Q_PROPERTY(int ReductionType READ getReductionType WRITE setReductionType)
+
+    /**
+     * @brief How the values of the Elements that belong to a Feature are combined into the Feature value
+     */
+    enum ReductionTypeEnum : int
+    {
+      LastValue = 0,  //!< Value of the Element with the largest index
+      FirstValue = 1, //!< Value of the Element with the smallest index
+      Mean = 2,       //!< Average of each component, rounded for integer types
+      Minimum = 3,    //!< Smallest value of each component
+      Maximum = 4,    //!< Largest value of each component
+      Mode = 5        //!< Most frequent value of each component, the smallest one on a tie
+    };
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
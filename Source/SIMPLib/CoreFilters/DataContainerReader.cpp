@@ -35,8 +35,11 @@
 
 #include "DataContainerReader.h"
 
+#include <mutex>
+
 #include <QtCore/QFileInfo>
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -255,6 +258,9 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   setErrorCondition(0);
   setWarningCondition(0);
 
+  // The file is read on this thread, not on the HDF5 I/O thread: the DataContainers and filters
+  // built here are QObjects that must belong to this thread. The readers lock the HDF5 library
+  // around their raw calls one DataContainer at a time instead.
   SIMPLH5DataReader::Pointer simplReader = SIMPLH5DataReader::New();
   connect(simplReader.get(), &SIMPLH5DataReader::errorGenerated, [=](const QString& title, const QString& msg, const int& code) {
     setErrorCondition(code);
@@ -324,6 +330,9 @@ DataContainerArrayProxy DataContainerReader::readDataContainerArrayStructure(con
 // -----------------------------------------------------------------------------
 int DataContainerReader::readExistingPipelineFromFile(hid_t fileId)
 {
+  // The pipeline is small and is read with raw HDF5 calls, so the library is locked for all of it
+  std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
+
   herr_t err = 0;
   m_PipelineFromFile->clear();
 
@@ -35,16 +35,25 @@
 
 #include "DataContainerWriter.h"
 
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
 #include <QtCore/QDir>
 
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Utilities.h"
+#include "H5Support/H5IOExecutor.h"
+#include "H5Support/H5ScopedDatasetCreationOptions.h"
 #include "H5Support/H5ScopedSentinel.h"
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/SIMPLibVersion.h"
@@ -65,6 +74,10 @@ DataContainerWriter::DataContainerWriter()
 , m_WritePipeline(true)
 , m_WriteXdmfFile(true)
 , m_WriteTimeSeries(false)
+, m_Compression(NoCompression)
+, m_CompressionLevel(5)
+, m_Shuffle(true)
+, m_ChunkSize(1024)
 , m_AppendToExisting(false)
 , m_FileId(-1)
 {
@@ -88,6 +101,16 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Parameter, DataContainerWriter));
+  {
+    QVector<QString> choices;
+    choices.push_back("None");
+    choices.push_back("Deflate");
+    choices.push_back("Fast (LZ4 if available)");
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Compression", Compression, FilterParameter::Parameter, DataContainerWriter, choices, false));
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (1-9)", CompressionLevel, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Shuffle Bytes Before Compression", Shuffle, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Chunk Size (KiB)", ChunkSize, FilterParameter::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -100,6 +123,10 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setCompression(reader->readValue("Compression", getCompression()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setShuffle(reader->readValue("Shuffle", getShuffle()));
+  setChunkSize(reader->readValue("ChunkSize", getChunkSize()));
   reader->closeFilterGroup();
 }
 
@@ -146,6 +173,25 @@ void DataContainerWriter::dataCheck()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
   }
 
+  if(m_Compression < NoCompression || m_Compression > FastCompression)
+  {
+    setErrorCondition(-10004);
+    ss = QObject::tr("The compression choice is not valid");
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  if(m_Compression == DeflateCompression && (m_CompressionLevel < 1 || m_CompressionLevel > 9))
+  {
+    setErrorCondition(-10005);
+    ss = QObject::tr("The compression level must be between 1 and 9");
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  if(m_Compression != NoCompression && m_ChunkSize <= 0)
+  {
+    setErrorCondition(-10006);
+    ss = QObject::tr("The chunk size must be greater than 0");
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+
 #ifdef _WIN32
   // Turn file permission checking on, if requested
 #ifdef SIMPL_NTFS_FILE_CHECK
@@ -224,6 +270,19 @@ void DataContainerWriter::execute()
   // This will make sure if we return early from this method that the HDF5 File is properly closed.
   H5ScopedFileSentinel scopedFileSentinel(&m_FileId, true);
 
+  // Every dataset created while writing this file uses the chosen chunking and compression. Chunks
+  // hold whole slabs of the slowest dimensions, so the cell data of an image geometry is chunked in
+  // complete Z slices (or rows of a slice when a single slice is larger than the chunk size).
+  H5Lite::DatasetCreationOptions datasetOptions;
+  if(m_Compression != NoCompression)
+  {
+    datasetOptions.chunkBytes = static_cast<size_t>(m_ChunkSize) * 1024;
+    datasetOptions.deflateLevel = m_CompressionLevel;
+    datasetOptions.shuffle = m_Shuffle;
+    datasetOptions.fastCompression = (m_Compression == FastCompression);
+  }
+  H5ScopedDatasetCreationOptions scopedDatasetOptions(datasetOptions);
+
   // Write our File Version string to the Root "/" group
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
@@ -262,58 +321,109 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(&dcaGid);
 
+  // The HDF5 writes of each DataContainer run on the I/O thread while this thread goes on to
+  // the next DataContainer. All writes must be finished before anything else touches the file,
+  // including the sentinel that closes it.
+  H5IOExecutor& ioExecutor = H5IOExecutor::Instance();
+  std::vector<std::future<int32_t>> pendingWrites;
+  std::shared_ptr<std::atomic<bool>> writeFailed = std::make_shared<std::atomic<bool>>(false);
+  auto waitForWrites = [&pendingWrites]() -> int32_t {
+    int32_t result = 0;
+    for(std::future<int32_t>& pendingWrite : pendingWrites)
+    {
+      int32_t writeErr = pendingWrite.get();
+      if(writeErr < 0 && result == 0)
+      {
+        result = writeErr;
+      }
+    }
+    pendingWrites.clear();
+    return result;
+  };
+
+  QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
   QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
     DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
     IGeometry::Pointer geometry = dc->getGeometry();
-    err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
-    if(err < 0)
+    if(m_WriteXdmfFile == true && geometry.get() != nullptr && getWriteTimeSeries())
     {
-      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
-      setErrorCondition(-60);
-      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      return;
+      geometry->setEnableTimeSeries(true);
+      geometry->setTimeValue(static_cast<float>(iter));
     }
 
-    hid_t dcGid = H5Gopen(dcaGid, dcNames[iter].toLatin1().data(), H5P_DEFAULT);
-    H5ScopedGroupSentinel groupSentinel(&dcGid, false);
-    // QString ss = QObject::tr("%1 |--> Writing %2 DataContainer ").arg(getMessagePrefix()).arg(dcNames[iter]);
-
-    // Have the DataContainer write all of its Attribute Matrices and its Mesh
-    err = dc->writeAttributeMatricesToHDF5(dcGid);
-    if(err < 0)
-    {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
-      return;
-    }
-    err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
-    if(err < 0)
-    {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
-      return;
-    }
+    // The Xdmf description is written before the DataContainer is queued because it reads the
+    // same structures the I/O thread walks. It overlaps with the write of the previous one.
     if(m_WriteXdmfFile == true && geometry.get() != nullptr)
     {
-
-      if(getWriteTimeSeries())
-      {
-        dc->getGeometry()->setEnableTimeSeries(true);
-        dc->getGeometry()->setTimeValue(static_cast<float>(iter));
-      }
 #if 0
       dc->getGeometry()->addAttributeMatrix(SIMPL::StringConstants::MetaData, dc->getAttributeMatrix(SIMPL::StringConstants::MetaData));
       dc->getGeometry()->setTemporalDataPath(DataArrayPath(dc->getName(), SIMPL::StringConstants::MetaData, "Step #"));
 #endif
-
-      QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
       err = dc->writeXdmf(xdmfOut, hdfFileName);
       if(err < 0)
       {
+        *writeFailed = true;
+        waitForWrites();
         notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
         return;
       }
     }
+
+    QString dcName = dcNames[iter];
+    bool writeXdmf = m_WriteXdmfFile;
+    pendingWrites.push_back(ioExecutor.submit([dc, dcName, dcaGid, writeXdmf, writeFailed]() -> int32_t {
+      if(*writeFailed)
+      {
+        return 0;
+      }
+      int32_t result = 0;
+      if(H5Utilities::createGroupsFromPath(dcName.toLatin1().data(), dcaGid) < 0)
+      {
+        result = -60;
+      }
+      else
+      {
+        // Only H5Support calls are made here, and the DataContainer writers lock the library
+        // around their own raw HDF5 calls, so other threads can use HDF5 between the steps
+        hid_t dcGid = QH5Utilities::openHDF5Object(dcaGid, dcName);
+        H5ScopedGroupSentinel groupSentinel(&dcGid, false);
+
+        // Have the DataContainer write all of its Attribute Matrices and its Mesh
+        if(dc->writeAttributeMatricesToHDF5(dcGid) < 0)
+        {
+          result = -803;
+        }
+        else if(dc->writeMeshToHDF5(dcGid, writeXdmf) < 0)
+        {
+          result = -804;
+        }
+      }
+      if(result < 0)
+      {
+        *writeFailed = true;
+      }
+      return result;
+    }));
+  }
+
+  err = waitForWrites();
+  if(err == -60)
+  {
+    setErrorCondition(-60);
+    notifyErrorMessage(getHumanLabel(), "Error creating HDF5 Group for a DataContainer", getErrorCondition());
+    return;
+  }
+  if(err == -803)
+  {
+    notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
+    return;
+  }
+  if(err == -804)
+  {
+    notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
+    return;
   }
 
   // Write the Data ContainerBundles
@@ -52,6 +52,10 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
     PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
     PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+    PYB11_PROPERTY(int Compression READ getCompression WRITE setCompression)
+    PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+    PYB11_PROPERTY(bool Shuffle READ getShuffle WRITE setShuffle)
+    PYB11_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
 
   public:
     SIMPL_SHARED_POINTERS(DataContainerWriter)
@@ -71,8 +75,27 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, WriteTimeSeries)
     Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+    SIMPL_FILTER_PARAMETER(int, Compression)
+    Q_PROPERTY(int Compression READ getCompression WRITE setCompression)
+
+    SIMPL_FILTER_PARAMETER(int, CompressionLevel)
+    Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+    SIMPL_FILTER_PARAMETER(bool, Shuffle)
+    Q_PROPERTY(bool Shuffle READ getShuffle WRITE setShuffle)
+
+    SIMPL_FILTER_PARAMETER(int, ChunkSize)
+    Q_PROPERTY(int ChunkSize READ getChunkSize WRITE setChunkSize)
+
     SIMPL_INSTANCE_PROPERTY(bool, AppendToExisting)
 
+    enum CompressionChoicesEnum : int
+    {
+      NoCompression = 0,
+      DeflateCompression = 1,
+      FastCompression = 2
+    };
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
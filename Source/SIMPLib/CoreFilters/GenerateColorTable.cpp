@@ -8,10 +8,10 @@
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
@@ -186,14 +186,16 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
   if (colorArray.get() == nullptr) { return; }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray),
-                      tbb::auto_partitioner());
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray),
+                        tbb::auto_partitioner());
+    });
   }
   else
 #endif
@@ -35,11 +35,17 @@
 
 #include "ImportAsciDataArray.h"
 
-#include <locale>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <vector>
 
-#include <QtCore/QFileInfo>
 #include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/ScopedFileMonitor.hpp"
@@ -54,6 +60,8 @@
 #include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
+#include "SIMPLib/Utilities/AsciiNumberParser.h"
+#include "SIMPLib/Utilities/MappedFileChunker.h"
 
 
 #define RBR_FILE_NOT_OPEN -1000
@@ -102,7 +110,155 @@ class DelimiterType : public std::ctype<char>
     }
 };
 
+// Returned by readMappedAsciFile() when the file could not be memory mapped
+const int32_t k_NotMapped = 1;
 
+// -----------------------------------------------------------------------------
+// Values are separated by the delimiter or by any white space, which is what the
+// DelimiterType locale gives std::istream
+// -----------------------------------------------------------------------------
+MappedFileChunker::BoundaryTable CreateSeparatorTable(char delimiter)
+{
+  return MappedFileChunker::CreateBoundaryTable({' ', '\t', '\n', '\v', '\f', '\r', delimiter});
+}
+
+/**
+ * @brief A run of whole values inside a mapped window along with the index of the first value
+ * in it that could not be converted
+ */
+struct AsciChunk : public MappedFileChunker::Chunk
+{
+  bool failed = false;
+  size_t errorIndex = 0;
+};
+
+// -----------------------------------------------------------------------------
+// Converts with std::istream in the "C" locale, which is how the values were always
+// read. Used for anything AsciiNumberParser does not handle itself.
+// -----------------------------------------------------------------------------
+template <typename K> bool StreamConvert(const char* begin, const char* end, K& value)
+{
+  std::istringstream in(std::string(begin, end));
+  in.imbue(std::locale::classic());
+  in >> value;
+  return !in.fail() && in.peek() == std::char_traits<char>::eof();
+}
+
+/**
+ * @brief The AsciValueConverter class reads a token as a K and casts it to the array's type T
+ */
+template <typename T, typename K> struct AsciValueConverter
+{
+  static bool Convert(const char* begin, const char* end, T& value)
+  {
+    K kValue = static_cast<K>(0);
+    if(!AsciiNumberParser::Parse<K>(begin, end, kValue) && !StreamConvert<K>(begin, end, kValue))
+    {
+      return false;
+    }
+    value = static_cast<T>(kValue);
+    return true;
+  }
+};
+
+/**
+ * @brief Boolean values are read as doubles and are true whenever any bit of the double is set
+ */
+template <> struct AsciValueConverter<bool, bool>
+{
+  static bool Convert(const char* begin, const char* end, bool& value)
+  {
+    double dValue = 0.0;
+    if(!AsciiNumberParser::Parse<double>(begin, end, dValue) && !StreamConvert<double>(begin, end, dValue))
+    {
+      return false;
+    }
+    value = (dValue != 0.0 || std::signbit(dValue));
+    return true;
+  }
+};
+
+/**
+ * @brief The CountAsciValues class counts the values in a chunk
+ */
+class CountAsciValues
+{
+public:
+  CountAsciValues(const MappedFileChunker::BoundaryTable& separators)
+  : m_Separators(separators)
+  {
+  }
+  virtual ~CountAsciValues() = default;
+
+  void operator()(const char* data, AsciChunk& chunk) const
+  {
+    size_t numValues = 0;
+    bool inValue = false;
+    for(size_t i = chunk.begin; i < chunk.end; i++)
+    {
+      bool isSeparator = m_Separators[static_cast<unsigned char>(data[i])];
+      if(!isSeparator && !inValue)
+      {
+        numValues++;
+      }
+      inValue = !isSeparator;
+    }
+    chunk.numRecords = numValues;
+  }
+
+private:
+  const MappedFileChunker::BoundaryTable& m_Separators;
+};
+
+/**
+ * @brief The ParseAsciValues class converts the values in a chunk straight into the destination
+ * array, starting at the chunk's first value index
+ */
+template <typename T, typename K> class ParseAsciValues
+{
+public:
+  ParseAsciValues(const MappedFileChunker::BoundaryTable& separators, T* destination, size_t totalSize)
+  : m_Separators(separators)
+  , m_Destination(destination)
+  , m_TotalSize(totalSize)
+  {
+  }
+  virtual ~ParseAsciValues() = default;
+
+  void operator()(const char* data, AsciChunk& chunk) const
+  {
+    size_t index = chunk.firstRecord;
+    size_t i = chunk.begin;
+    while(i < chunk.end && index < m_TotalSize)
+    {
+      while(i < chunk.end && m_Separators[static_cast<unsigned char>(data[i])])
+      {
+        i++;
+      }
+      if(i == chunk.end)
+      {
+        break;
+      }
+      size_t tokenStart = i;
+      while(i < chunk.end && !m_Separators[static_cast<unsigned char>(data[i])])
+      {
+        i++;
+      }
+      if(!AsciValueConverter<T, K>::Convert(data + tokenStart, data + i, m_Destination[index]))
+      {
+        chunk.failed = true;
+        chunk.errorIndex = index;
+        break;
+      }
+      index++;
+    }
+  }
+
+private:
+  const MappedFileChunker::BoundaryTable& m_Separators;
+  T* m_Destination;
+  size_t m_TotalSize;
+};
 }
 
 // -----------------------------------------------------------------------------
@@ -132,7 +288,7 @@ int check_error_bits(std::ifstream* f)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T, typename K> int32_t readAsciFile(typename DataArray<T>::Pointer data, const QString& filename, int32_t skipHeaderLines, char delimiter, bool inputIsBool = false)
+template <typename T, typename K> int32_t readAsciFileStream(typename DataArray<T>::Pointer data, const QString& filename, int32_t skipHeaderLines, char delimiter, bool inputIsBool = false)
 {
   int32_t err = 0;
   QFileInfo fi(filename);
@@ -217,6 +373,70 @@ template <typename T, typename K> int32_t readAsciFile(typename DataArray<T>::Po
   return RBR_NO_ERROR;
 }
 
+// -----------------------------------------------------------------------------
+// Reads the file with a MappedFileChunker whose chunks hold whole values, so the values are
+// counted and converted in parallel straight into the array.
+// -----------------------------------------------------------------------------
+template <typename T, typename K> int32_t readMappedAsciFile(QFile& inputFile, typename DataArray<T>::Pointer data, int32_t skipHeaderLines, char delimiter, size_t& errorIndex)
+{
+  size_t totalSize = data->getNumberOfTuples() * static_cast<size_t>(data->getNumberOfComponents());
+  if(totalSize == 0)
+  {
+    return RBR_NO_ERROR;
+  }
+  MappedFileChunker::BoundaryTable separators = Detail::CreateSeparatorTable(delimiter);
+  Detail::CountAsciValues counter(separators);
+  Detail::ParseAsciValues<T, K> parser(separators, data->getPointer(0), totalSize);
+
+  MappedFileChunker chunker(inputFile, separators, static_cast<size_t>(std::max(skipHeaderLines, 0)));
+  MappedFileChunker::Status status = chunker.read<Detail::AsciChunk>(totalSize, counter, parser, [&](const std::vector<Detail::AsciChunk>& chunks) {
+    for(const Detail::AsciChunk& chunk : chunks)
+    {
+      if(chunk.failed)
+      {
+        errorIndex = chunk.errorIndex;
+        return false;
+      }
+    }
+    return true;
+  });
+
+  if(status == MappedFileChunker::Status::Stopped)
+  {
+    return RBR_READ_ERROR;
+  }
+  if(status == MappedFileChunker::Status::NotMapped)
+  {
+    return Detail::k_NotMapped;
+  }
+  if(status == MappedFileChunker::Status::EndOfFile)
+  {
+    return RBR_READ_EOF;
+  }
+  return RBR_NO_ERROR;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K>
+int32_t readAsciFile(typename DataArray<T>::Pointer data, const QString& filename, int32_t skipHeaderLines, char delimiter, size_t& errorIndex, bool inputIsBool = false)
+{
+  QFile inputFile(filename);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    return RBR_FILE_NOT_OPEN;
+  }
+
+  int32_t err = readMappedAsciFile<T, K>(inputFile, data, skipHeaderLines, delimiter, errorIndex);
+  inputFile.close();
+  if(err == Detail::k_NotMapped)
+  {
+    err = readAsciFileStream<T, K>(data, filename, skipHeaderLines, delimiter, inputIsBool);
+  }
+  return err;
+}
+
 
 
 /* ############## Start Private Implementation ############################### */
@@ -520,12 +740,13 @@ void ImportAsciDataArray::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getCreatedAttributeArrayPath().getDataContainerName());
 
   char delimiter = converSelectedDelimiter();
+  size_t errorIndex = std::numeric_limits<size_t>::max();
 
   QVector<size_t> cDims(1, m_NumberOfComponents);
   if(m_ScalarType == SIMPL::NumericTypes::Type::Int8)
   {
     Int8ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int8ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<int8_t, int32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<int8_t, int32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -534,7 +755,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt8)
   {
     UInt8ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt8ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<uint8_t, uint32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<uint8_t, uint32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -543,7 +764,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int16)
   {
     Int16ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int16ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<int16_t,int16_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<int16_t,int16_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -552,7 +773,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt16)
   {
     UInt16ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt16ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<uint16_t,uint16_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<uint16_t,uint16_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -561,7 +782,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int32)
   {
     Int32ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int32ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<int32_t,int32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<int32_t,int32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -570,7 +791,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt32)
   {
     UInt32ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt32ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<uint32_t,uint32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<uint32_t,uint32_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -579,7 +800,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int64)
   {
     Int64ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int64ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<int64_t,int64_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<int64_t,int64_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -588,7 +809,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt64)
   {
     UInt64ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt64ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<uint64_t,uint64_t>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<uint64_t,uint64_t>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -597,7 +818,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Float)
   {
     FloatArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<FloatArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<float,float>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<float,float>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -606,7 +827,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Double)
   {
     DoubleArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<DoubleArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<double,double>(p, m_InputFile, m_SkipHeaderLines, delimiter);
+    err = readAsciFile<double,double>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex);
     if(err >= 0)
     {
       m_Array = p;
@@ -615,7 +836,7 @@ void ImportAsciDataArray::execute()
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Bool)
   {
     BoolArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<BoolArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readAsciFile<bool, bool>(p, m_InputFile, m_SkipHeaderLines, delimiter, true);
+    err = readAsciFile<bool, bool>(p, m_InputFile, m_SkipHeaderLines, delimiter, errorIndex, true);
     if(err >= 0)
     {
       m_Array = p;
@@ -640,7 +861,12 @@ void ImportAsciDataArray::execute()
   else if(err == RBR_READ_ERROR)
   {
     setErrorCondition(RBR_READ_ERROR);
-    notifyErrorMessage(getHumanLabel(), "General read error while importing ASCI file.", getErrorCondition());
+    QString ss = "General read error while importing ASCI file.";
+    if(errorIndex != std::numeric_limits<size_t>::max())
+    {
+      ss = QString("Unable to convert the value at index %1 while importing ASCI file.").arg(errorIndex);
+    }
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
   }
   else if(err == RBR_READ_EOF)
   {
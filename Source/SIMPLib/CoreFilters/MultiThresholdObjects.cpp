@@ -40,7 +40,7 @@
 #include "SIMPLib/FilterParameters/ComparisonSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -207,59 +207,35 @@ void MultiThresholdObjects::execute()
 
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
+  AttributeMatrix::Pointer am = m->getAttributeMatrix(amName);
 
-  // Prime our output array with the result of the first comparison
+  // Every comparison must hold for a tuple to pass, so they are all merged with AND and then
+  // evaluated together in one pass over the tuples
+  ThresholdEvaluator evaluator;
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), m_DestinationPtr.lock().get());
-    if(err < 0)
+    ComparisonInput_t& compRef = m_SelectedThresholds[i];
+    if(!evaluator.addComparison(am->getAttributeArray(compRef.attributeArrayName), compRef.compOperator, compRef.compValue, SIMPL::Union::Operator_And))
     {
-      DataArrayPath tempPath(comp_0.dataContainerName, comp_0.attributeMatrixName, comp_0.attributeArrayName);
-      QString ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
-      setErrorCondition(-13001);
-      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      return;
-    }
-  }
-
-  if(m_SelectedThresholds.size() > 1)
-  {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 1; i < m_SelectedThresholds.size(); ++i)
-    {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
-      ComparisonInput_t& compRef = m_SelectedThresholds[i];
-
-      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
-
-      err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName).get(), currentArrayPtr.get());
-      if(err < 0)
+      DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
+      QString ss;
+      if(i == 0)
       {
-        DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
-        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-        setErrorCondition(-13002);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
+        ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
+        setErrorCondition(-13001);
       }
-      for(int64_t p = 0; p < totalTuples; ++p)
+      else
       {
-        if(m_Destination[p] == false || currentArray[p] == false)
-        {
-          m_Destination[p] = false;
-        }
+        ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+        setErrorCondition(-13002);
       }
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
     }
   }
 
+  evaluator.execute(m_Destination, am->getNumberOfTuples());
+
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
@@ -40,7 +40,7 @@
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -197,14 +197,13 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  // Get the first comparison object
-  AbstractComparison::Pointer comp_0 = m_SelectedThresholds[0];
   // Get the names of the Data Container and AttributeMatrix for later
   QString dcName = m_SelectedThresholds.getDataContainerName();
   QString amName = m_SelectedThresholds.getAttributeMatrixName();
 
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
+  AttributeMatrix::Pointer am = m->getAttributeMatrix(amName);
 
   // At least one threshold value is required
   if (!m_SelectedThresholds.hasComparisonValue())
@@ -214,227 +213,55 @@ void MultiThresholdObjects2::execute()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
-  else
-  {
-    bool invert = m_SelectedThresholds.shouldInvert();
-
-    int64_t thresholdSize;
-    BoolArrayType::Pointer thresholdArray;
-
-    createBoolArray(thresholdSize, thresholdArray);
-    bool firstValueFound = false;
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
-    {
-      if (std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-      {
-        ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-        thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-      else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-      {
-        ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-        thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-    }
-
-    if (invert)
-    {
-      invertThreshold(thresholdSize, thresholdArray);
-    }
 
-    bool* threshold = thresholdArray->getPointer(0);
-    for (int64_t p = 0; p < thresholdSize; p++)
-    {
-      m_Destination[p] = threshold[p];
-    }
-    
-  }
-  
-  /* Let the GUI know we are done with this filter */
-  notifyStatusMessage(getHumanLabel(), "Complete");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
+  // Compile the whole comparison tree and then evaluate it in one pass over the tuples
+  ThresholdEvaluator evaluator;
+  evaluator.setInvert(m_SelectedThresholds.shouldInvert());
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    // invert the current comparison if necessary
-    if (inverse)
+    if(!addComparison(m_SelectedThresholds[i], am, evaluator))
     {
-      newArray[i] = !newArray[i];
-    }
-
-    if (SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if (currentArray[i] == false || newArray[i] == false)
-    {
-      currentArray[i] = false;
+      return;
     }
   }
-}
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
+  evaluator.execute(m_Destination, am->getNumberOfTuples());
 
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
+  /* Let the GUI know we are done with this filter */
+  notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
+bool MultiThresholdObjects2::addComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& am, ThresholdEvaluator& evaluator)
 {
-  if (nullptr == comparisonSet)
+  if(ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
   {
-    return;
-  }
-
-  if (inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for (int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if (std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    { 
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if (std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if (err < 0)
+    evaluator.beginSet(comparisonSet->getUnionOperator(), comparisonSet->getInvertComparison());
+    QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
+    for(int i = 0; i < comparisons.size(); i++)
     {
-      return;
+      if(!addComparison(comparisons[i], am, evaluator))
+      {
+        return false;
+      }
     }
+    evaluator.endSet();
   }
-
-  if (replaceInput)
+  else if(ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison))
   {
-    if (inverse)
+    IDataArray::Pointer input = am->getAttributeArray(comparisonValue->getAttributeArrayName());
+    if(!evaluator.addComparison(input, comparisonValue->getCompOperator(), comparisonValue->getCompValue(), comparisonValue->getUnionOperator()))
     {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
-{
-  if (nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  //bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()).get(), currentArrayPtr.get());
-  if (err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  
-  if (replaceInput)
-  {
-    if (inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
+      DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      setErrorCondition(-13002);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return false;
     }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else 
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
   }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
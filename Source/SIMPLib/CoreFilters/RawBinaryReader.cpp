@@ -39,9 +39,12 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/ScopedFileMonitor.hpp"
+#include "SIMPLib/DataArrays/DataArrayBulkOps.hpp"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
@@ -55,25 +58,9 @@
 #define RBR_FILE_TOO_SMALL -1010
 #define RBR_FILE_TOO_BIG -1020
 #define RBR_READ_EOF -1030
+#define RBR_ALLOCATION_FAILED -1040
 #define RBR_NO_ERROR 0
 
-
-#ifdef CMP_WORDS_BIGENDIAN
-#define SWAP_ARRAY(array)                                                                                                                                                                              \
-  if(m_Endian == 0)                                                                                                                                                                                    \
-  {                                                                                                                                                                                                    \
-    array->byteSwapElements();                                                                                                                                                                         \
-  }
-
-#else
-#define SWAP_ARRAY(array)                                                                                                                                                                              \
-  if(m_Endian == 1)                                                                                                                                                                                    \
-  {                                                                                                                                                                                                    \
-    array->byteSwapElements();                                                                                                                                                                         \
-  }
-
-#endif
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -94,7 +81,56 @@ int32_t SanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fil
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> int32_t readBinaryFile(typename DataArray<T>::Pointer p, const QString& filename, int32_t skipHeaderBytes)
+template <typename T> int32_t allocateArray(typename DataArray<T>::Pointer p)
+{
+  if(p->isAllocated())
+  {
+    return RBR_NO_ERROR;
+  }
+  return (p->allocate() < 0) ? RBR_ALLOCATION_FAILED : RBR_NO_ERROR;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> int32_t mapBinaryFile(typename DataArray<T>::Pointer& p, const QString& filename, int32_t skipHeaderBytes, bool swap)
+{
+  size_t numBytesToRead = p->getSize() * sizeof(T);
+  void* mapped = DataArrayStorage::MapFile(filename, skipHeaderBytes, numBytesToRead);
+  if(nullptr == mapped)
+  {
+    return RBR_FILE_NOT_OPEN;
+  }
+
+  if(!swap && reinterpret_cast<uintptr_t>(mapped) % alignof(T) == 0)
+  {
+    // The file already holds the values exactly as the array would, so the mapping becomes the
+    // storage of a new array that replaces the unallocated one. DataArray::releaseOwnership() copies
+    // the mapping to the heap, so the file mapping itself is never handed to another owner.
+    p = DataArray<T>::WrapPointer(static_cast<T*>(mapped), p->getNumberOfTuples(), p->getComponentDimensions(), p->getName(), true);
+    return RBR_NO_ERROR;
+  }
+
+  int32_t err = allocateArray<T>(p);
+  if(err == RBR_NO_ERROR)
+  {
+    if(swap)
+    {
+      DataArrayBulkOps::ByteSwapCopy<T>(p->getPointer(0), mapped, p->getSize());
+    }
+    else
+    {
+      DataArrayBulkOps::Copy<T>(p->getPointer(0), mapped, p->getSize());
+    }
+  }
+  DataArrayStorage::Deallocate(mapped);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> int32_t readBinaryFile(typename DataArray<T>::Pointer& p, const QString& filename, int32_t skipHeaderBytes, bool swap, bool memoryMap)
 {
   int32_t err = 0;
   QFileInfo fi(filename);
@@ -107,6 +143,17 @@ template <typename T> int32_t readBinaryFile(typename DataArray<T>::Pointer p, c
     return RBR_FILE_TOO_SMALL;
   }
 
+  if(memoryMap && allocatedBytes > 0 && mapBinaryFile<T>(p, filename, skipHeaderBytes, swap) == RBR_NO_ERROR)
+  {
+    return RBR_NO_ERROR;
+  }
+
+  err = allocateArray<T>(p);
+  if(err < 0)
+  {
+    return err;
+  }
+
   FILE* f = fopen(filename.toLatin1().data(), "rb");
   if(nullptr == f)
   {
@@ -152,9 +199,32 @@ template <typename T> int32_t readBinaryFile(typename DataArray<T>::Pointer p, c
     }
   }
 
+  if(swap)
+  {
+    p->byteSwapElements();
+  }
+
   return RBR_NO_ERROR;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void createRawArray(AbstractFilter* filter, const DataArrayPath& path, const QVector<size_t>& cDims, bool allocate)
+{
+  DataContainerArray::Pointer dca = filter->getDataContainerArray();
+  AttributeMatrix::Pointer attrMat = dca->getAttributeMatrix(path);
+  QString name = path.getDataArrayName();
+  if(!allocate && nullptr != attrMat.get() && !name.isEmpty() && !name.contains('/') && nullptr == attrMat->getAttributeArray(name).get())
+  {
+    // execute() fills the storage straight from the file, so the array is not zero filled first
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(attrMat->getNumberOfTuples(), cDims, name, false);
+    attrMat->addAttributeArray(name, array);
+    return;
+  }
+  dca->createNonPrereqArrayFromPath<DataArray<T>, AbstractFilter, T>(filter, path, 0, cDims, "CreatedAttributeArrayPath");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -165,6 +235,7 @@ RawBinaryReader::RawBinaryReader()
 , m_NumberOfComponents(0)
 , m_SkipHeaderBytes(0)
 , m_InputFile("")
+, m_MemoryMapFile(false)
 {
 
 }
@@ -199,6 +270,7 @@ void RawBinaryReader::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Skip Header Bytes", SkipHeaderBytes, FilterParameter::Parameter, RawBinaryReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Memory Map Input File", MemoryMapFile, FilterParameter::Parameter, RawBinaryReader));
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Output Attribute Array", CreatedAttributeArrayPath, FilterParameter::CreatedArray, RawBinaryReader, req));
@@ -218,6 +290,7 @@ void RawBinaryReader::readFilterParameters(AbstractFilterParametersReader* reade
   setNumberOfComponents(reader->readValue("NumberOfComponents", getNumberOfComponents()));
   setEndian(reader->readValue("Endian", getEndian()));
   setSkipHeaderBytes(reader->readValue("SkipHeaderBytes", getSkipHeaderBytes()));
+  setMemoryMapFile(reader->readValue("MemoryMapFile", getMemoryMapFile()));
 
   reader->closeFilterGroup();
 }
@@ -273,54 +346,56 @@ void RawBinaryReader::dataCheck()
 
   size_t allocatedBytes = 0;
   QVector<size_t> cDims(1, m_NumberOfComponents);
+  // A memory mapped file provides the values of the array during execute
+  bool allocate = getInPreflight() || !getMemoryMapFile();
   if(m_ScalarType == SIMPL::NumericTypes::Type::Int8)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<Int8ArrayType, AbstractFilter, int8_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<int8_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(int8_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt8)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<UInt8ArrayType, AbstractFilter, uint8_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<uint8_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(uint8_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int16)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<Int16ArrayType, AbstractFilter, int16_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<int16_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(int16_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt16)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<UInt16ArrayType, AbstractFilter, uint16_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<uint16_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(uint16_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int32)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<Int32ArrayType, AbstractFilter, int32_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<int32_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(int32_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt32)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<UInt32ArrayType, AbstractFilter, uint32_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<uint32_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(uint32_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int64)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<Int64ArrayType, AbstractFilter, int64_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<int64_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(int64_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt64)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<UInt64ArrayType, AbstractFilter, uint64_t>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<uint64_t>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(uint64_t) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Float)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType, AbstractFilter, float>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<float>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(float) * m_NumberOfComponents * totalDim;
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Double)
   {
-    getDataContainerArray()->createNonPrereqArrayFromPath<DoubleArrayType, AbstractFilter, double>(this, getCreatedAttributeArrayPath(), 0, cDims, "CreatedAttributeArrayPath");
+    createRawArray<double>(this, getCreatedAttributeArrayPath(), cDims, allocate);
     allocatedBytes = sizeof(double) * m_NumberOfComponents * totalDim;
   }
 
@@ -377,108 +452,109 @@ void RawBinaryReader::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getCreatedAttributeArrayPath().getDataContainerName());
 
-  QVector<size_t> cDims(1, m_NumberOfComponents);
+#ifdef CMP_WORDS_BIGENDIAN
+  bool swap = (m_Endian == 0);
+#else
+  bool swap = (m_Endian == 1);
+#endif
+
   if(m_ScalarType == SIMPL::NumericTypes::Type::Int8)
   {
     Int8ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int8ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<int8_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<int8_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt8)
   {
     UInt8ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt8ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<uint8_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<uint8_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int16)
   {
     Int16ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int16ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<int16_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<int16_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt16)
   {
     UInt16ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt16ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<uint16_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<uint16_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int32)
   {
     Int32ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int32ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<int32_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<int32_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt32)
   {
     UInt32ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt32ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<uint32_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<uint32_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Int64)
   {
     Int64ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<Int64ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<int64_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<int64_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::UInt64)
   {
     UInt64ArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<UInt64ArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<uint64_t>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<uint64_t>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Float)
   {
     FloatArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<FloatArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<float>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<float>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
   else if(m_ScalarType == SIMPL::NumericTypes::Type::Double)
   {
     DoubleArrayType::Pointer p = getDataContainerArray()->getPrereqIDataArrayFromPath<DoubleArrayType, AbstractFilter>(this, getCreatedAttributeArrayPath());
-    err = readBinaryFile<double>(p, m_InputFile, m_SkipHeaderBytes);
+    err = readBinaryFile<double>(p, m_InputFile, m_SkipHeaderBytes, swap, getMemoryMapFile());
     if(err >= 0)
     {
-      SWAP_ARRAY(p)
       m_Array = p;
     }
   }
 
+  if(err >= 0 && nullptr != m_Array.get())
+  {
+    // A memory mapped file is wrapped by a new array that takes the place of the one from dataCheck
+    getDataContainerArray()->getAttributeMatrix(getCreatedAttributeArrayPath())->addAttributeArray(m_Array->getName(), m_Array);
+  }
+
   if(err == RBR_FILE_NOT_OPEN)
   {
     setErrorCondition(RBR_FILE_NOT_OPEN);
@@ -499,6 +575,11 @@ void RawBinaryReader::execute()
     setErrorCondition(RBR_READ_EOF);
     notifyErrorMessage(getHumanLabel(), "RawBinaryReader read past the end of the specified file", getErrorCondition());
   }
+  else if(err == RBR_ALLOCATION_FAILED)
+  {
+    setErrorCondition(RBR_ALLOCATION_FAILED);
+    notifyErrorMessage(getHumanLabel(), "Unable to allocate the memory for the array", getErrorCondition());
+  }
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
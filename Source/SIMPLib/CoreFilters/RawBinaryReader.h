@@ -52,6 +52,7 @@ class SIMPLib_EXPORT RawBinaryReader : public AbstractFilter
     PYB11_PROPERTY(int NumberOfComponents READ getNumberOfComponents WRITE setNumberOfComponents)
     PYB11_PROPERTY(int SkipHeaderBytes READ getSkipHeaderBytes WRITE setSkipHeaderBytes)
     PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
+    PYB11_PROPERTY(bool MemoryMapFile READ getMemoryMapFile WRITE setMemoryMapFile)
 
   public:
     SIMPL_SHARED_POINTERS(RawBinaryReader)
@@ -78,6 +79,14 @@ class SIMPLib_EXPORT RawBinaryReader : public AbstractFilter
     SIMPL_FILTER_PARAMETER(QString, InputFile)
     Q_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
 
+    /**
+     * @brief When true the input file is memory mapped. If the values need no byte swapping the
+     * mapping itself becomes the storage of the created array, otherwise the values are swapped
+     * straight out of the mapping. Reading falls back to fread if the file can not be mapped.
+     */
+    SIMPL_FILTER_PARAMETER(bool, MemoryMapFile)
+    Q_PROPERTY(bool MemoryMapFile READ getMemoryMapFile WRITE setMemoryMapFile)
+
 
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
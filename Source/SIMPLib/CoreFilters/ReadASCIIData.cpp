@@ -4,12 +4,18 @@
 
 #include "ReadASCIIData.h"
 
+#include <cstring>
+#include <vector>
+
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/Utilities/MappedFileChunker.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
@@ -20,6 +26,214 @@
 
 namespace {
    const QString k_Skip("Skip");
+
+/**
+ * @brief A run of whole lines inside a mapped window along with the first error found in it
+ */
+struct ASCIIChunk : public MappedFileChunker::Chunk
+{
+  int errorCondition = 0;
+  size_t errorTuple = 0;
+  int errorColumn = 0;
+  int foundColumns = 0;
+  QString errorText;
+  // The string column tokens of each parsed line, line by line, for the serial pass
+  QVector<QString> strings;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString InconsistentColumnsMessage(size_t lineNum, int expected, int found, const QString& line)
+{
+  QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+  QTextStream out(&ss);
+  out << "Expecting " << expected << " but found " << found << "\n";
+  out << "Input line was:\n";
+  out << line;
+  return ss;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ConversionFailureMessage(const QString& errorMessage, size_t lineNum, int column)
+{
+  return errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(column) + ").";
+}
+
+/**
+ * @brief The CountASCIILines class counts the lines in a chunk. A last line that is not
+ * terminated by a newline still counts as a line.
+ */
+class CountASCIILines
+{
+public:
+  CountASCIILines() = default;
+  virtual ~CountASCIILines() = default;
+
+  void operator()(const char* data, ASCIIChunk& chunk) const
+  {
+    const char* pos = data + chunk.begin;
+    const char* last = data + chunk.end;
+    size_t numLines = 0;
+    while(pos < last)
+    {
+      numLines++;
+      const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(last - pos)));
+      if(newline == nullptr)
+      {
+        break;
+      }
+      pos = newline + 1;
+    }
+    chunk.numRecords = numLines;
+  }
+};
+
+/**
+ * @brief The ParseASCIILines class tokenizes each line of a chunk in place and hands the
+ * tokens to the column parsers, which write them into the tuple given by the line's position in
+ * the file. Parsing a chunk stops at its first error, which is recorded in the chunk.
+ *
+ * Chunks are parsed concurrently, but a StringDataArray shares one buffer between all of its
+ * values and cannot be written from several threads. The tokens of the string columns are only
+ * copied into the chunk here and setChunkStrings() stores them after the window is parsed.
+ */
+class ParseASCIILines
+{
+public:
+  ParseASCIILines(size_t numTuples, const MappedFileChunker::BoundaryTable& delimiters, bool hasDelimiters, int numColumns, const QList<AbstractDataParser::Pointer>& dataParsers,
+                  const QList<AbstractDataParser::Pointer>& stringParsers)
+  : m_NumTuples(numTuples)
+  , m_Delimiters(delimiters)
+  , m_HasDelimiters(hasDelimiters)
+  , m_NumColumns(numColumns)
+  , m_DataParsers(dataParsers)
+  , m_StringParsers(stringParsers)
+  {
+  }
+  virtual ~ParseASCIILines() = default;
+
+  void operator()(const char* data, ASCIIChunk& chunk) const
+  {
+    std::vector<std::pair<const char*, const char*>> tokens;
+    tokens.reserve(static_cast<size_t>(m_NumColumns) + 1);
+
+    const char* pos = data + chunk.begin;
+    const char* last = data + chunk.end;
+    size_t tuple = chunk.firstRecord;
+
+    while(pos < last && tuple < m_NumTuples)
+    {
+      const char* lineEnd = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(last - pos)));
+      const char* next = (lineEnd == nullptr) ? last : lineEnd + 1;
+      if(lineEnd == nullptr)
+      {
+        lineEnd = last;
+      }
+      if(lineEnd > pos && *(lineEnd - 1) == '\r')
+      {
+        lineEnd--;
+      }
+
+      tokenize(pos, lineEnd, tokens);
+      if(static_cast<int>(tokens.size()) != m_NumColumns)
+      {
+        chunk.errorCondition = ReadASCIIData::INCONSISTENT_COLS;
+        chunk.errorTuple = tuple;
+        chunk.foundColumns = static_cast<int>(tokens.size());
+        chunk.errorText = QString::fromLocal8Bit(pos, static_cast<int>(lineEnd - pos));
+        break;
+      }
+
+      for(const AbstractDataParser::Pointer& parser : m_DataParsers)
+      {
+        int index = parser->getColumnIndex();
+        ParserFunctor::ErrorObject obj = parser->parse(tokens[index].first, tokens[index].second, tuple);
+        if(!obj.ok)
+        {
+          chunk.errorCondition = ReadASCIIData::CONVERSION_FAILURE;
+          chunk.errorTuple = tuple;
+          chunk.errorColumn = index;
+          chunk.errorText = obj.errorMessage;
+          break;
+        }
+      }
+      if(chunk.errorCondition < 0)
+      {
+        break;
+      }
+
+      for(const AbstractDataParser::Pointer& parser : m_StringParsers)
+      {
+        int index = parser->getColumnIndex();
+        chunk.strings.push_back(QString::fromLocal8Bit(tokens[index].first, static_cast<int>(tokens[index].second - tokens[index].first)));
+      }
+
+      tuple++;
+      pos = next;
+    }
+  }
+
+  /**
+   * @brief Stores the string column tokens that were collected for a chunk. Must be called from
+   * one thread at a time.
+   * @param chunk
+   */
+  void setChunkStrings(const ASCIIChunk& chunk) const
+  {
+    if(m_StringParsers.isEmpty())
+    {
+      return;
+    }
+    int numStringColumns = m_StringParsers.size();
+    for(int i = 0; i < chunk.strings.size(); i++)
+    {
+      size_t tuple = chunk.firstRecord + static_cast<size_t>(i / numStringColumns);
+      m_StringParsers[i % numStringColumns]->parse(chunk.strings[i], tuple);
+    }
+  }
+
+private:
+  size_t m_NumTuples;
+  const MappedFileChunker::BoundaryTable& m_Delimiters;
+  bool m_HasDelimiters;
+  int m_NumColumns;
+  const QList<AbstractDataParser::Pointer>& m_DataParsers;
+  const QList<AbstractDataParser::Pointer>& m_StringParsers;
+
+  /**
+   * @brief Splits a line the same way StringOperations::TokenizeString does: empty tokens are
+   * dropped and a line is a single token when there are no delimiters.
+   */
+  void tokenize(const char* begin, const char* end, std::vector<std::pair<const char*, const char*>>& tokens) const
+  {
+    tokens.clear();
+    if(!m_HasDelimiters)
+    {
+      tokens.emplace_back(begin, end);
+      return;
+    }
+
+    const char* tokenStart = begin;
+    for(const char* c = begin; c != end; ++c)
+    {
+      if(m_Delimiters[static_cast<unsigned char>(*c)])
+      {
+        if(c != tokenStart)
+        {
+          tokens.emplace_back(tokenStart, c);
+        }
+        tokenStart = c + 1;
+      }
+    }
+    if(end != tokenStart)
+    {
+      tokens.emplace_back(tokenStart, end);
+    }
+  }
+};
 }
 
 // -----------------------------------------------------------------------------
@@ -442,10 +656,6 @@ void ReadASCIIData::execute()
   QString inputFilePath = wizardData.inputFilePath;
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
-  QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
-  int numLines = wizardData.numberOfLines;
-  int beginIndex = wizardData.beginIndex;
 
   QList<AbstractDataParser::Pointer> dataParsers;
   for(int i = 0; i < headers.size(); i++)
@@ -521,78 +731,195 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
-
   QFile inputFile(inputFilePath);
   if(inputFile.open(QIODevice::ReadOnly))
   {
-    QTextStream in(&inputFile);
-
-    for(int i = 1; i < beginIndex; i++)
+    if(!readMappedFile(inputFile, dataParsers))
     {
-      // Skip to the first data line
-      in.readLine();
+      inputFile.seek(0);
+      readFileStream(inputFile, dataParsers);
     }
+    inputFile.close();
+  }
 
-    float threshold = 0.0f;
-    size_t numTuples = numLines - beginIndex + 1;
+  if(getErrorCondition() < 0 || getCancel())
+  {
+    return;
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ReadASCIIData::readMappedFile(QFile& inputFile, const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  ASCIIWizardData wizardData = getWizardData();
+  int numColumns = wizardData.dataTypes.size();
+  int beginIndex = wizardData.beginIndex;
+  size_t numTuples = wizardData.numberOfLines - beginIndex + 1;
+  size_t linesToSkip = (beginIndex > 1) ? static_cast<size_t>(beginIndex - 1) : 0;
 
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
+  MappedFileChunker::BoundaryTable delimiterTable = MappedFileChunker::CreateBoundaryTable(wizardData.delimiters.toVector().toStdVector());
+  bool hasDelimiters = !wizardData.delimiters.isEmpty();
+
+  MappedFileChunker chunker(inputFile, MappedFileChunker::CreateBoundaryTable({'\n'}), linesToSkip);
+  chunker.setFirstWindowCheck([](const char* data, size_t dataSize, size_t& pos) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    if(dataSize >= 2 && ((bytes[0] == 0xFF && bytes[1] == 0xFE) || (bytes[0] == 0xFE && bytes[1] == 0xFF)))
+    {
+      // UTF-16 text needs the decoding that QTextStream does
+      return false;
+    }
+    if(dataSize >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
     {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+      pos = 3;
+    }
+    // Files that end their lines with a lone carriage return are also left to QTextStream
+    const char* newline = static_cast<const char*>(std::memchr(data + pos, '\n', dataSize - pos));
+    size_t firstLineLength = (newline == nullptr) ? dataSize - pos : static_cast<size_t>(newline - (data + pos));
+    const char* carriageReturn = static_cast<const char*>(std::memchr(data + pos, '\r', firstLineLength));
+    return nullptr == carriageReturn || carriageReturn + 1 == newline;
+  });
 
-      if(dataTypes.size() != tokens.size())
+  // String columns are stored after each window is parsed, see ParseASCIILines
+  QList<AbstractDataParser::Pointer> valueParsers;
+  QList<AbstractDataParser::Pointer> stringParsers;
+  for(const AbstractDataParser::Pointer& dataParser : dataParsers)
+  {
+    if(nullptr != std::dynamic_pointer_cast<StringDataArray>(dataParser->getDataArray()))
+    {
+      stringParsers.push_back(dataParser);
+    }
+    else
+    {
+      valueParsers.push_back(dataParser);
+    }
+  }
+
+  CountASCIILines counter;
+  ParseASCIILines parser(numTuples, delimiterTable, hasDelimiters, numColumns, valueParsers, stringParsers);
+  float threshold = 0.0f;
+
+  MappedFileChunker::Status status = chunker.read<ASCIIChunk>(numTuples, counter, parser, [&](const std::vector<ASCIIChunk>& chunks) {
+    // Report the error that comes first in the file
+    for(const ASCIIChunk& chunk : chunks)
+    {
+      parser.setChunkStrings(chunk);
+      if(chunk.errorCondition == INCONSISTENT_COLS)
       {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
+        QString ss = InconsistentColumnsMessage(beginIndex + chunk.errorTuple, numColumns, chunk.foundColumns, chunk.errorText);
         setErrorCondition(INCONSISTENT_COLS);
         notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
+        return false;
       }
-
-      for(int i = 0; i < dataParsers.size(); i++)
+      if(chunk.errorCondition == CONVERSION_FAILURE)
       {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-          return;
-        }
+        QString ss = ConversionFailureMessage(chunk.errorText, beginIndex + chunk.errorTuple, chunk.errorColumn);
+        setErrorCondition(CONVERSION_FAILURE);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return false;
       }
+    }
+
+    float percent = (static_cast<float>(chunker.getRecordsRead()) / numTuples) * 100.0f;
+    if(percent > threshold)
+    {
+      QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(percent, 0, 'f', 0);
+      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+      threshold = percent + 5.0f;
+    }
 
-      if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
+    return !getCancel();
+  });
+
+  if(status == MappedFileChunker::Status::NotMapped)
+  {
+    return false;
+  }
+  if(status == MappedFileChunker::Status::EndOfFile)
+  {
+    // The file ended before the expected number of lines was read
+    QString ss = InconsistentColumnsMessage(beginIndex + chunker.getRecordsRead(), numColumns, 0, QString());
+    setErrorCondition(INCONSISTENT_COLS);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadASCIIData::readFileStream(QFile& inputFile, const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  ASCIIWizardData wizardData = getWizardData();
+  QStringList dataTypes = wizardData.dataTypes;
+  QList<char> delimiters = wizardData.delimiters;
+  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
+  int numLines = wizardData.numberOfLines;
+  int beginIndex = wizardData.beginIndex;
+
+  int insertIndex = 0;
+
+  QTextStream in(&inputFile);
+
+  for(int i = 1; i < beginIndex; i++)
+  {
+    // Skip to the first data line
+    in.readLine();
+  }
+
+  float threshold = 0.0f;
+  size_t numTuples = numLines - beginIndex + 1;
+
+  for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
+  {
+    QString line = in.readLine();
+    QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+
+    if(dataTypes.size() != tokens.size())
+    {
+      QString ss = InconsistentColumnsMessage(lineNum, dataTypes.size(), tokens.size(), line);
+      setErrorCondition(INCONSISTENT_COLS);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    for(int i = 0; i < dataParsers.size(); i++)
+    {
+      AbstractDataParser::Pointer parser = dataParsers[i];
+      int index = parser->getColumnIndex();
+
+      ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
+      if(!obj.ok)
       {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
-        {
-          threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-        }
+        QString ss = ConversionFailureMessage(obj.errorMessage, lineNum, index);
+        setErrorCondition(CONVERSION_FAILURE);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
       }
+    }
 
-      if(getCancel())
+    if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
+    {
+      // Print the status of the import
+      QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
+      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+      threshold = threshold + 5.0f;
+      if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
       {
-        return;
+        threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
       }
+    }
 
-      insertIndex++;
+    if(getCancel())
+    {
+      return;
     }
-    inputFile.close();
-  }
 
-  notifyStatusMessage(getHumanLabel(), "Complete");
+    insertIndex++;
+  }
 }
 
 // -----------------------------------------------------------------------------
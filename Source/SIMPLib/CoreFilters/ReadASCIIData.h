@@ -4,12 +4,17 @@
 
 #pragma once
 
+#include <memory>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
 
+class AbstractDataParser;
+class QFile;
+
 /**
  * @brief The ReadASCIIData class. See [Filter documentation](@ref ReadASCIIData) for details.
  */
@@ -159,6 +164,23 @@ class SIMPLib_EXPORT ReadASCIIData : public AbstractFilter
      */
     void initialize();
 
+    /**
+     * @brief readMappedFile Parses the input file by memory mapping it in large, line aligned
+     * windows. Each window is split into chunks of whole lines that are parsed in parallel
+     * straight from the mapped bytes. String columns are stored serially once their window is
+     * parsed.
+     * @param inputFile The open input file
+     * @param dataParsers The parsers for the imported columns
+     * @return false if the file could not be mapped and must be read with readFileStream() instead
+     */
+    bool readMappedFile(QFile& inputFile, const QList<std::shared_ptr<AbstractDataParser>>& dataParsers);
+
+    /**
+     * @brief readFileStream Parses the input file one line at a time using a QTextStream
+     * @param inputFile The open input file
+     * @param dataParsers The parsers for the imported columns
+     */
+    void readFileStream(QFile& inputFile, const QList<std::shared_ptr<AbstractDataParser>>& dataParsers);
 
   private:
     QMap<int, IDataArray::Pointer>        m_ASCIIArrayMap;
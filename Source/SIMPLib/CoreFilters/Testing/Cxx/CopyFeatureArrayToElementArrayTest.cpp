@@ -0,0 +1,221 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/FeatureDataView.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class CopyFeatureArrayToElementArrayTest
+{
+public:
+  const size_t k_NumElements = 10000;
+  const size_t k_NumFeatures = 37;
+
+  CopyFeatureArrayToElementArrayTest() = default;
+  virtual ~CopyFeatureArrayToElementArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the CopyFeatureArrayToElementArray Filter from the FilterManager
+    QString filtName = "CopyFeatureArrayToElementArray";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      std::stringstream ss;
+      ss << "The CopyFeatureArrayToElementArrayTest Requires the use of the " << filtName.toStdString() << " filter which is found in the Core Filters";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateFilter(const QVector<size_t>& cDims)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+
+    AttributeMatrix::Pointer cellAttr = AttributeMatrix::New(QVector<size_t>(1, k_NumElements), "CellData", AttributeMatrix::Type::Cell);
+    AttributeMatrix::Pointer featureAttr = AttributeMatrix::New(QVector<size_t>(1, k_NumFeatures), "FeatureData", AttributeMatrix::Type::CellFeature);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumElements, "FeatureIds");
+    for(size_t i = 0; i < k_NumElements; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>((i * 7) % k_NumFeatures));
+    }
+
+    FloatArrayType::Pointer featureData = FloatArrayType::CreateArray(k_NumFeatures, cDims, "FeatureValues");
+    for(size_t i = 0; i < featureData->getSize(); i++)
+    {
+      featureData->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+
+    cellAttr->addAttributeArray(featureIds->getName(), featureIds);
+    featureAttr->addAttributeArray(featureData->getName(), featureData);
+    dc->addAttributeMatrix(cellAttr->getName(), cellAttr);
+    dc->addAttributeMatrix(featureAttr->getName(), featureAttr);
+    dca->addDataContainer(dc);
+
+    QString filtName = "CopyFeatureArrayToElementArray";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get())
+
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(DataArrayPath("DataContainer", "FeatureData", "FeatureValues"));
+    bool propWasSet = filter->setProperty("SelectedFeatureArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(DataArrayPath("DataContainer", "CellData", "FeatureIds"));
+    propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    propWasSet = filter->setProperty("CreatedArrayName", "CopiedValues");
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCopyComponents()
+  {
+    // 1 and 3 components use the unrolled gathers, 5 the generic one
+    QVector<size_t> numComps = {1, 3, 5};
+    for(size_t numComp : numComps)
+    {
+      AbstractFilter::Pointer filter = CreateFilter(QVector<size_t>(1, numComp));
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0)
+
+      DataContainerArray::Pointer dca = filter->getDataContainerArray();
+      FloatArrayType::Pointer featureData = dca->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, DataArrayPath("DataContainer", "FeatureData", "FeatureValues"), QVector<size_t>(1, numComp));
+      Int32ArrayType::Pointer featureIds = dca->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, DataArrayPath("DataContainer", "CellData", "FeatureIds"), QVector<size_t>(1, 1));
+      FloatArrayType::Pointer copied = dca->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, DataArrayPath("DataContainer", "CellData", "CopiedValues"), QVector<size_t>(1, numComp));
+      DREAM3D_REQUIRE_VALID_POINTER(copied.get())
+      DREAM3D_REQUIRE_EQUAL(copied->getNumberOfTuples(), k_NumElements)
+
+      FeatureDataView<float> view(featureData, featureIds);
+      DREAM3D_REQUIRE_EQUAL(view.isValid(), true)
+      DREAM3D_REQUIRE_EQUAL(view.getNumberOfTuples(), k_NumElements)
+      for(size_t i = 0; i < k_NumElements; i++)
+      {
+        size_t featureId = static_cast<size_t>(featureIds->getValue(i));
+        for(size_t c = 0; c < numComp; c++)
+        {
+          DREAM3D_REQUIRE_EQUAL(copied->getComponent(i, c), featureData->getComponent(featureId, c))
+          DREAM3D_REQUIRE_EQUAL(view.getComponent(i, static_cast<int>(c)), featureData->getComponent(featureId, c))
+        }
+      }
+
+      // Gathering part of the view matches the copied array
+      std::vector<float> chunk(100 * numComp);
+      view.gather(5000, 5100, chunk.data());
+      for(size_t i = 0; i < chunk.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(chunk[i], copied->getValue(5000 * numComp + i))
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestInvalidFeatureIds()
+  {
+    DataArrayPath featureIdsPath("DataContainer", "CellData", "FeatureIds");
+
+    AbstractFilter::Pointer filter = CreateFilter(QVector<size_t>(1, 1));
+    Int32ArrayType::Pointer featureIds = filter->getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, featureIdsPath, QVector<size_t>(1, 1));
+    featureIds->setValue(k_NumElements - 1, static_cast<int32_t>(k_NumFeatures));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5555)
+    // The Feature Ids are checked before the Element array is created
+    DREAM3D_REQUIRE_EQUAL(filter->getDataContainerArray()->getAttributeMatrix(featureIdsPath)->doesAttributeArrayExist("CopiedValues"), false)
+
+    filter = CreateFilter(QVector<size_t>(1, 1));
+    featureIds = filter->getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, featureIdsPath, QVector<size_t>(1, 1));
+    featureIds->setValue(k_NumElements / 2, -1);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5557)
+
+    // Every Feature Id is valid but the last Feature is never used
+    filter = CreateFilter(QVector<size_t>(1, 1));
+    featureIds = filter->getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, featureIdsPath, QVector<size_t>(1, 1));
+    featureIds->initializeWithValue(0);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5555)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### CopyFeatureArrayToElementArrayTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestCopyComponents())
+    DREAM3D_REGISTER_TEST(TestInvalidFeatureIds())
+  }
+
+private:
+  CopyFeatureArrayToElementArrayTest(const CopyFeatureArrayToElementArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const CopyFeatureArrayToElementArrayTest&);                     // Move assignment Not Implemented
+};
@@ -37,6 +37,7 @@
 #include <QtCore/QFile>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/CoreFilters/CreateFeatureArrayFromElementArray.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -341,6 +342,90 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer RunReduction(int reductionType, int32_t badFeatureId)
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("CreateFeatureArrayFromElementArray");
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get())
+    AbstractFilter::Pointer filter = filterFactory->create();
+
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer cellAttr = AttributeMatrix::New(QVector<size_t>(1, 16), "Cell Attribute Matrix", AttributeMatrix::Type::Cell);
+    AttributeMatrix::Pointer featureAttr = AttributeMatrix::New(QVector<size_t>(1, 5), "Feature Attribute Matrix", AttributeMatrix::Type::CellFeature);
+
+    // Feature 0 owns no Elements; the cell values are 0 0 0 1 1 1 2 2 2 3 3 3 4 4 4 5
+    int32_t ids[16] = {1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4};
+    ids[15] = (badFeatureId != 0) ? badFeatureId : ids[15];
+    DataArray<int32_t>::Pointer featureIds = DataArray<int32_t>::CreateArray(16, "FeatureIds");
+    DataArray<float>::Pointer cellDataArray = DataArray<float>::CreateArray(16, "CellData");
+    for(size_t i = 0; i < 16; i++)
+    {
+      featureIds->setValue(i, ids[i]);
+      cellDataArray->setValue(i, static_cast<float>(i / 3));
+    }
+
+    cellAttr->addAttributeArray("CellData", cellDataArray);
+    cellAttr->addAttributeArray("FeatureIds", featureIds);
+    dc->addAttributeMatrix("Cell Attribute Matrix", cellAttr);
+    dc->addAttributeMatrix("Feature Attribute Matrix", featureAttr);
+    dca->addDataContainer(dc);
+
+    QVariant var;
+    var.setValue(DataArrayPath(dc->getName(), cellAttr->getName(), cellDataArray->getName()));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true)
+    var.setValue(DataArrayPath(dc->getName(), cellAttr->getName(), featureIds->getName()));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("FeatureIdsArrayPath", var), true)
+    var.setValue(DataArrayPath(dc->getName(), featureAttr->getName(), QString()));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("CellFeatureAttributeMatrixName", var), true)
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("CreatedArrayName", "CreatedArray"), true)
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ReductionType", reductionType), true)
+
+    filter->execute();
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReductionTypes()
+  {
+    // One row per ReductionType, in enum order, holding the expected value of Features 0 through 4
+    const float expected[6][5] = {
+        {0.0f, 1.0f, 2.0f, 4.0f, 5.0f},    // Last Value
+        {0.0f, 0.0f, 0.0f, 2.0f, 3.0f},    // First Value
+        {0.0f, 0.5f, 1.25f, 3.25f, 3.75f}, // Mean
+        {0.0f, 0.0f, 0.0f, 2.0f, 3.0f},    // Minimum
+        {0.0f, 1.0f, 2.0f, 4.0f, 5.0f},    // Maximum
+        {0.0f, 0.0f, 2.0f, 4.0f, 3.0f},    // Mode
+    };
+
+    for(int reductionType = 0; reductionType < 6; reductionType++)
+    {
+      AbstractFilter::Pointer filter = RunReduction(reductionType, 0);
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+      DataArrayPath createdPath("DataContainer", "Feature Attribute Matrix", "CreatedArray");
+      FloatArrayType::Pointer created = filter->getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, createdPath, QVector<size_t>(1, 1));
+      DREAM3D_REQUIRE_VALID_POINTER(created.get())
+      for(size_t f = 0; f < 5; f++)
+      {
+        DREAM3D_REQUIRE_EQUAL(created->getValue(f), expected[reductionType][f])
+      }
+    }
+
+    // Invalid Feature Ids are reported after the reduction
+    AbstractFilter::Pointer filter = RunReduction(CreateFeatureArrayFromElementArray::Mean, -2);
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5557)
+    filter = RunReduction(CreateFeatureArrayFromElementArray::Mode, 7);
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5555)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -352,6 +437,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestReductionTypes())
   }
 
 private:
@@ -48,6 +48,7 @@
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/StructArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -110,6 +111,11 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString CropFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Crop.h5");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -136,6 +142,7 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::CropFile());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -460,6 +467,128 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadCroppedDataContainer(const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount, int& err)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::CropFile());
+    reader->setDataContainerArray(dca);
+    DataContainerArrayProxy dcaProxy = reader->readDataContainerArrayStructure(DataContainerIOTest::CropFile());
+    DataContainerProxy& dcProxy = dcaProxy.dataContainers[SIMPL::Defaults::ImageDataContainerName];
+    dcProxy.tupleOffset = tupleOffset;
+    dcProxy.tupleCount = tupleCount;
+    reader->setInputFileDataContainerArrayProxy(dcaProxy);
+    reader->execute();
+    err = reader->getErrorCondition();
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes a 5 x 4 x 3 Image Geometry and reads a 3 x 2 x 2 box of its cells back
+  // -----------------------------------------------------------------------------
+  void TestDataContainerReaderSubregion()
+  {
+    size_t nx = DataContainerIOTest::XSize;
+    size_t ny = DataContainerIOTest::YSize;
+    size_t nz = DataContainerIOTest::ZSize;
+    size_t size = nx * ny * nz;
+
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+      dca->addDataContainer(m);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(std::make_tuple(nx, ny, nz));
+      image->setResolution(0.5f, 1.0f, 2.0f);
+      image->setOrigin(10.0f, 20.0f, 30.0f);
+      m->setGeometry(image);
+
+      QVector<size_t> tupleDims = {nx, ny, nz};
+      AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+      m->addAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName, attrMat);
+
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(size, SIMPL::CellData::FeatureIds);
+      QVector<size_t> dims(1, 3);
+      FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(size, dims, SIMPL::CellData::EulerAngles);
+      for(size_t i = 0; i < size; ++i)
+      {
+        featureIds->setValue(i, static_cast<int32_t>(i + DataContainerIOTest::Offset));
+        for(int c = 0; c < 3; c++)
+        {
+          eulers->setComponent(i, c, static_cast<float>(i * 3 + c));
+        }
+      }
+      attrMat->addAttributeArray(SIMPL::CellData::FeatureIds, featureIds);
+      attrMat->addAttributeArray(SIMPL::CellData::EulerAngles, eulers);
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::CropFile());
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+    }
+
+    QVector<size_t> tupleOffset = {1, 1, 1};
+    QVector<size_t> tupleCount = {3, 2, 2};
+    int err = 0;
+    DataContainerArray::Pointer dca = ReadCroppedDataContainer(tupleOffset, tupleCount, err);
+    DREAM3D_REQUIRE(err >= 0)
+
+    DataContainer::Pointer m = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    DREAM3D_REQUIRE_VALID_POINTER(m.get())
+    ImageGeom::Pointer image = m->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+
+    size_t dims[3] = {0, 0, 0};
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+    image->getOrigin(origin);
+    DREAM3D_REQUIRE_EQUAL(dims[0], 3)
+    DREAM3D_REQUIRE_EQUAL(dims[1], 2)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 2)
+    DREAM3D_REQUIRE_EQUAL(origin[0], 10.5f)
+    DREAM3D_REQUIRE_EQUAL(origin[1], 21.0f)
+    DREAM3D_REQUIRE_EQUAL(origin[2], 32.0f)
+
+    AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+    DREAM3D_REQUIRE_VALID_POINTER(attrMat.get())
+    DREAM3D_REQUIRE(attrMat->getTupleDimensions() == tupleCount)
+
+    Int32ArrayType::Pointer featureIds = attrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    FloatArrayType::Pointer eulers = attrMat->getAttributeArrayAs<FloatArrayType>(SIMPL::CellData::EulerAngles);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_VALID_POINTER(eulers.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), 12)
+    DREAM3D_REQUIRE_EQUAL(eulers->getNumberOfTuples(), 12)
+
+    size_t index = 0;
+    for(size_t z = 0; z < tupleCount[2]; z++)
+    {
+      for(size_t y = 0; y < tupleCount[1]; y++)
+      {
+        for(size_t x = 0; x < tupleCount[0]; x++)
+        {
+          size_t fileIndex = ((z + tupleOffset[2]) * ny + (y + tupleOffset[1])) * nx + (x + tupleOffset[0]);
+          DREAM3D_REQUIRE_EQUAL(featureIds->getValue(index), static_cast<int32_t>(fileIndex + DataContainerIOTest::Offset))
+          for(int c = 0; c < 3; c++)
+          {
+            DREAM3D_REQUIRE_EQUAL(eulers->getComponent(index, c), static_cast<float>(fileIndex * 3 + c))
+          }
+          index++;
+        }
+      }
+    }
+
+    // A subregion that runs past the end of the geometry is an error
+    tupleOffset = {3, 0, 0};
+    tupleCount = {3, 4, 3};
+    ReadCroppedDataContainer(tupleOffset, tupleCount, err);
+    DREAM3D_REQUIRE(err < 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -635,6 +764,48 @@ public:
     dap2.update("Foo", "Bar", "Baz");
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataContainerArraySnapshot()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims(1, 10);
+    QVector<size_t> cDims(1, 3);
+    AttributeMatrix::Pointer cellAm = dc->createAndAddAttributeMatrix(tDims, "CellData", AttributeMatrix::Type::Cell);
+    AttributeMatrix::Pointer featureAm = dc->createAndAddAttributeMatrix(tDims, "FeatureData", AttributeMatrix::Type::CellFeature);
+    cellAm->addAttributeArray("Eulers", FloatArrayType::CreateArray(10, cDims, "Eulers", false));
+    featureAm->addAttributeArray("Size", Int32ArrayType::CreateArray(10, "Size", false));
+
+    DataContainerArray::Pointer snap0 = dca->createSnapshot(DataContainerArray::NullPointer());
+    DREAM3D_REQUIRE_EQUAL(snap0->isSnapshot(), true)
+    DREAM3D_REQUIRE_EQUAL(snap0->doesAttributeArrayExist(DataArrayPath("DataContainer", "CellData", "Eulers")), true)
+    AttributeMatrix::Pointer snapCellAm = snap0->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", ""));
+    DREAM3D_REQUIRE(snapCellAm.get() != cellAm.get())
+
+    // Only the FeatureData AttributeMatrix changes so the CellData node should be shared
+    featureAm->addAttributeArray("Volume", FloatArrayType::CreateArray(10, "Volume", false));
+    DataContainerArray::Pointer snap1 = dca->createSnapshot(snap0);
+    DREAM3D_REQUIRE(snap1->getAttributeMatrix(DataArrayPath("DataContainer", "CellData", "")).get() == snapCellAm.get())
+    AttributeMatrix::Pointer snapFeatureAm0 = snap0->getAttributeMatrix(DataArrayPath("DataContainer", "FeatureData", ""));
+    AttributeMatrix::Pointer snapFeatureAm1 = snap1->getAttributeMatrix(DataArrayPath("DataContainer", "FeatureData", ""));
+    DREAM3D_REQUIRE(snapFeatureAm0.get() != snapFeatureAm1.get())
+    DREAM3D_REQUIRE(snapFeatureAm0->getAttributeArray("Size").get() == snapFeatureAm1->getAttributeArray("Size").get())
+    DREAM3D_REQUIRE_EQUAL(snap0->doesAttributeArrayExist(DataArrayPath("DataContainer", "FeatureData", "Volume")), false)
+    DREAM3D_REQUIRE_EQUAL(snap1->doesAttributeArrayExist(DataArrayPath("DataContainer", "FeatureData", "Volume")), true)
+
+    // Renaming inside one snapshot must not leak into the snapshots it shares nodes with
+    DataArrayPath::RenameContainer renames;
+    renames.push_back(DataArrayPath::RenameType(DataArrayPath("DataContainer", "CellData", "Eulers"), DataArrayPath("DataContainer", "CellData", "Angles")));
+    snap1->renameDataArrayPaths(renames);
+    DREAM3D_REQUIRE_EQUAL(snap1->doesAttributeArrayExist(DataArrayPath("DataContainer", "CellData", "Angles")), true)
+    DREAM3D_REQUIRE_EQUAL(snap0->doesAttributeArrayExist(DataArrayPath("DataContainer", "CellData", "Eulers")), true)
+    DREAM3D_REQUIRE_EQUAL(snap0->doesAttributeArrayExist(DataArrayPath("DataContainer", "CellData", "Angles")), false)
+    DREAM3D_REQUIRE_EQUAL(snapCellAm->getAttributeArray("Eulers")->getName(), QString("Eulers"))
+  }
+
 #if 0
     template<typename T, typename K>
     void _arrayCreation(VolumeDataContainer::Pointer m)
@@ -905,7 +1076,9 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestDataContainerReaderSubregion())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
+    DREAM3D_REGISTER_TEST(TestDataContainerArraySnapshot())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <limits>
 
 #include "SIMPLib/Common/Observer.h"
 
@@ -12,9 +13,12 @@
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Utilities/MappedFileChunker.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+#include "RemoveArraysObserver.h"
+
 class ImportAsciDataArrayTest
 {
 
@@ -220,6 +224,107 @@ public:
     RunTest<bool>('\t', 4, 10);
   }
 
+  // -----------------------------------------------------------------------------
+  // Writes numValues comma separated values after a single header line. The value at badIndex
+  // is written so that it can not be converted.
+  // -----------------------------------------------------------------------------
+  void writeLargeFile(size_t numValues, size_t badIndex)
+  {
+    std::ofstream outfile;
+    outfile.open(getOutputFile().c_str(), std::ios_base::binary);
+    outfile << "Index Values" << std::endl;
+    for(size_t i = 0; i < numValues; i++)
+    {
+      if(i == badIndex)
+      {
+        outfile << "12x";
+      }
+      else
+      {
+        outfile << i;
+      }
+      outfile << ((i % 16 == 15) ? '\n' : ',');
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reads a file that spans many mapped windows, each split into many chunks
+  // -----------------------------------------------------------------------------
+  int RunLargeFileTest(size_t badIndex)
+  {
+    const size_t numValues = 200000;
+    writeLargeFile(numValues, badIndex);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims = {numValues};
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, "AttributeMatrix", AttributeMatrix::Type::Generic);
+    dc->addAttributeMatrix(attrMat->getName(), attrMat);
+
+    AbstractFilter::Pointer filter = FilterManager::Instance()->getFactoryFromClassName(QString("ImportAsciDataArray"))->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant value;
+    value.setValue(DataArrayPath("ImageDataContainer", "AttributeMatrix", "ImportedData"));
+    bool propSet = filter->setProperty("CreatedAttributeArrayPath", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+    value.setValue(4); // int32
+    propSet = filter->setProperty("ScalarType", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+    value.setValue(1);
+    propSet = filter->setProperty("NumberOfComponents", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+    value.setValue(1);
+    propSet = filter->setProperty("SkipHeaderLines", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+    value.setValue(QString::fromStdString(getOutputFile()));
+    propSet = filter->setProperty("InputFile", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+    value.setValue(0); // Comma
+    propSet = filter->setProperty("Delimiter", value);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    RemoveArraysObserver::Pointer obs = RemoveArraysObserver::New();
+    QObject::connect(filter.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), obs.get(), SLOT(processPipelineMessage(const PipelineMessage&)));
+
+    qint64 windowSize = MappedFileChunker::GetWindowSize();
+    size_t chunkSize = MappedFileChunker::GetChunkSize();
+    MappedFileChunker::SetWindowSize(64 * 1024);
+    MappedFileChunker::SetChunkSize(4 * 1024);
+    filter->execute();
+    MappedFileChunker::SetWindowSize(windowSize);
+    MappedFileChunker::SetChunkSize(chunkSize);
+
+    if(badIndex < numValues)
+    {
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -1040)
+      QString expected = QString("Unable to convert the value at index %1 while importing ASCI file.").arg(badIndex);
+      bool found = false;
+      for(const PipelineMessage& msg : obs->getErrorList())
+      {
+        found = found || (msg.getText() == expected);
+      }
+      DREAM3D_REQUIRE(found)
+      return EXIT_SUCCESS;
+    }
+
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    Int32ArrayType::Pointer dataPtr = attrMat->getAttributeArrayAs<Int32ArrayType>("ImportedData");
+    DREAM3D_REQUIRE_VALID_POINTER(dataPtr.get())
+    for(size_t i = 0; i < numValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(dataPtr->getValue(i), static_cast<int32_t>(i))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  void LargeFile()
+  {
+    RunLargeFileTest(std::numeric_limits<size_t>::max());
+    RunLargeFileTest(150001);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -233,6 +338,7 @@ public:
     DREAM3D_REGISTER_TEST(Space())
     DREAM3D_REGISTER_TEST(Colon())
     DREAM3D_REGISTER_TEST(Tab())
+    DREAM3D_REGISTER_TEST(LargeFile())
   }
 
 private:
@@ -334,6 +334,40 @@ public:
     compSet->setInvertComparison(true);
     ComparisonSetTest(filter, compSet, SIMPL::GeneralData::ThresholdArray + QString::number(3), expectedOutput);
 
+    // Nested ComparisonSet: x < 3 OR (x > 15 AND x != 17)
+    ComparisonSet::Pointer compSet4 = ComparisonSet::New();
+
+    ComparisonValue::Pointer comp3 = ComparisonValue::New();
+    comp3->setAttributeArrayName(path.getDataArrayName());
+    comp3->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp3->setCompValue(3);
+    compSet4->addComparison(comp3);
+
+    ComparisonSet::Pointer childSet = ComparisonSet::New();
+    childSet->setUnionOperator(SIMPL::Union::Operator_Or);
+
+    ComparisonValue::Pointer comp4 = ComparisonValue::New();
+    comp4->setAttributeArrayName(path.getDataArrayName());
+    comp4->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp4->setCompValue(15);
+    childSet->addComparison(comp4);
+
+    ComparisonValue::Pointer comp5 = ComparisonValue::New();
+    comp5->setUnionOperator(SIMPL::Union::Operator_And);
+    comp5->setAttributeArrayName(path.getDataArrayName());
+    comp5->setCompOperator(SIMPL::Comparison::Operator_NotEqual);
+    comp5->setCompValue(17);
+    childSet->addComparison(comp5);
+
+    compSet4->addComparison(childSet);
+
+    bool expectedOutput4[] = {true,  true,  true,  false, false,  // 0, 1, 2, 3, 4
+                              false, false, false, false, false,  // 5, 6, 7, 8, 9
+                              false, false, false, false, false,  // 10, 11, 12, 13, 14
+                              false, true,  false, true,  true};  // 15, 16, 17, 18, 19
+
+    ComparisonSetTest(filter, compSet4, SIMPL::GeneralData::ThresholdArray + QString::number(4), expectedOutput4);
+
     return 1;
   }
 
@@ -36,6 +36,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <cstring>
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -62,6 +65,9 @@
  *  testCase5: This tests when the file size is larger than the allocated size and there is junk at the beginning and end of the file.
  *
  *  testCase6: This tests when skipHeaderBytes equals the file size
+ *
+ *  testCase7: This tests memory mapped reads, with and without byte swapping and with unaligned header sizes,
+ *             and releasing ownership of a mapped array
  */
 
 /** we are going to use a fairly large array size because we want to exercise the
@@ -868,6 +874,120 @@ public:
     testCase6_TestPrimitives<double>("double", SIMPL::NumericTypes::Type::Double);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  // testCase7: This tests memory mapped reads. Little endian files with an aligned header are wrapped without
+  // copying; big endian files and unaligned headers are copied out of the mapping.
+  template <typename T, size_t N> void testCase7_Execute(const QString& name, SIMPL::NumericTypes::Type scalarType, Detail::Endian endian, int skipHeaderBytes)
+  {
+    size_t dataArraySize = k_ArraySize * N;
+    std::vector<T> expected(dataArraySize);
+    std::vector<uint8_t> bytes(static_cast<size_t>(skipHeaderBytes) + dataArraySize * sizeof(T), 0xAB);
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      expected[i] = static_cast<T>(i);
+      uint8_t* value = reinterpret_cast<uint8_t*>(&expected[i]);
+      for(size_t b = 0; b < sizeof(T); b++)
+      {
+        size_t dest = (endian == Detail::Big) ? sizeof(T) - 1 - b : b;
+        bytes[skipHeaderBytes + i * sizeof(T) + dest] = value[b];
+      }
+    }
+
+    FILE* f = fopen(UnitTest::RawBinaryReaderTest::OutputFile.toLatin1().data(), "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(f)
+    size_t numWritten = fwrite(bytes.data(), 1, bytes.size(), f);
+    fclose(f);
+    DREAM3D_REQUIRE_EQUAL(numWritten, bytes.size())
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, k_ArraySize), "AttributeMatrix", AttributeMatrix::Type::Any);
+    DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+    m->addAttributeMatrix("AttributeMatrix", am);
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    dca->addDataContainer(m);
+
+    RawBinaryReader::Pointer filt = createRawBinaryReaderFilter(scalarType, N, skipHeaderBytes);
+    filt->setEndian(endian);
+    filt->setMemoryMapFile(true);
+    filt->setDataContainerArray(dca);
+    filt->preflight();
+    DREAM3D_REQUIRED(filt->getErrorCondition(), >=, 0)
+    am->clearAttributeArrays();
+
+    filt->execute();
+    DREAM3D_REQUIRED(filt->getErrorCondition(), >=, 0)
+
+    typename DataArray<T>::Pointer data = std::dynamic_pointer_cast<DataArray<T>>(am->getAttributeArray("Test_Array"));
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->getSize(), dataArraySize)
+    for(size_t i = 0; i < dataArraySize; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), expected[i])
+    }
+
+    // Little endian values behind an aligned header are the file mapping itself
+    bool wrapped = (endian == Detail::Little && skipHeaderBytes % alignof(T) == 0);
+    DREAM3D_REQUIRE_EQUAL(data->isMemoryMapped(), wrapped)
+
+    // The mapping is private, so writing into the array must leave the file alone
+    data->setValue(0, static_cast<T>(1));
+
+    // Handing the memory to another owner (the ITK in-place bridge does this) must give it a heap
+    // copy that can be free()'ed instead of the file mapping
+    data->releaseOwnership();
+    DREAM3D_REQUIRE_EQUAL(data->isMemoryMapped(), false)
+    T* released = data->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(released[0], static_cast<T>(1))
+    for(size_t i = 1; i < dataArraySize; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(released[i], expected[i])
+    }
+    data = DataArray<T>::NullPointer();
+    am->clearAttributeArrays();
+    free(released);
+    QFile file(UnitTest::RawBinaryReaderTest::OutputFile);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true)
+    QByteArray contents = file.readAll();
+    DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(contents.size()), bytes.size())
+    DREAM3D_REQUIRE_EQUAL(std::memcmp(contents.constData(), bytes.data(), bytes.size()), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void testCase7_TestPrimitives(const QString& name, SIMPL::NumericTypes::Type scalarType)
+  {
+    testCase7_Execute<T, 1>(name, scalarType, Detail::Little, 0);
+    testCase7_Execute<T, 3>(name, scalarType, Detail::Little, static_cast<int>(sizeof(T)) * 4);
+    testCase7_Execute<T, 2>(name, scalarType, Detail::Little, 3);
+    testCase7_Execute<T, 1>(name, scalarType, Detail::Big, static_cast<int>(sizeof(T)));
+    testCase7_Execute<T, 3>(name, scalarType, Detail::Big, 5);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void testCase7()
+  {
+    QDir dir(UnitTest::RawBinaryReaderTest::TestDir);
+    if(!dir.mkpath("."))
+    {
+      return;
+    }
+
+    testCase7_TestPrimitives<int8_t>("int8_t", SIMPL::NumericTypes::Type::Int8);
+    testCase7_TestPrimitives<uint8_t>("uint8_t", SIMPL::NumericTypes::Type::UInt8);
+    testCase7_TestPrimitives<int16_t>("int16_t", SIMPL::NumericTypes::Type::Int16);
+    testCase7_TestPrimitives<uint16_t>("uint16_t", SIMPL::NumericTypes::Type::UInt16);
+    testCase7_TestPrimitives<int32_t>("int32_t", SIMPL::NumericTypes::Type::Int32);
+    testCase7_TestPrimitives<uint32_t>("uint32_t", SIMPL::NumericTypes::Type::UInt32);
+    testCase7_TestPrimitives<int64_t>("int64_t", SIMPL::NumericTypes::Type::Int64);
+    testCase7_TestPrimitives<uint64_t>("uint64_t", SIMPL::NumericTypes::Type::UInt64);
+    testCase7_TestPrimitives<float>("float", SIMPL::NumericTypes::Type::Float);
+    testCase7_TestPrimitives<double>("double", SIMPL::NumericTypes::Type::Double);
+  }
+
   // -----------------------------------------------------------------------------
   //  Use unit test framework
   // -----------------------------------------------------------------------------
@@ -885,6 +1005,7 @@ public:
     DREAM3D_REGISTER_TEST(testCase3())
     DREAM3D_REGISTER_TEST(testCase4())
     DREAM3D_REGISTER_TEST(testCase5())
+    DREAM3D_REGISTER_TEST(testCase7())
 // Broken when moving away from Boost
 // DREAM3D_REGISTER_TEST(testCase6())
 
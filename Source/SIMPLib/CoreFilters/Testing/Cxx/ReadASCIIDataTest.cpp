@@ -41,6 +41,7 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -410,6 +411,88 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLargeFile()
+  {
+    // Enough lines that the file is split into several chunks that are parsed separately. The
+    // string column checks that its values land in the right tuples when the chunks run in parallel
+    const size_t numLines = 200000;
+    const size_t badLine = 150000;
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 3;
+    data.consecutiveDelimiters = true;
+    data.dataHeaders.push_back(DataArrayName);
+    data.dataHeaders.push_back("Array2");
+    data.dataHeaders.push_back("Array3");
+    data.dataTypes.push_back(SIMPL::TypeNames::Int32);
+    data.dataTypes.push_back(SIMPL::TypeNames::Double);
+    data.dataTypes.push_back(SIMPL::TypeNames::String);
+    data.delimiters.push_back(',');
+    data.delimiters.push_back(' ');
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile2;
+    data.numberOfLines = static_cast<int>(numLines + 2);
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, numLines);
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+      QFile file(UnitTest::ReadASCIIDataTest::TestFile2);
+      DREAM3D_REQUIRE_EQUAL(file.open(QFile::WriteOnly), true)
+      QTextStream out(&file);
+      out << "Header Line\r\n";
+      out << DataArrayName << ", Array2, Array3\r\n";
+      for(size_t i = 0; i < numLines; i++)
+      {
+        if(pass == 1 && i == badLine)
+        {
+          out << "abc, 0.5, Name\r\n";
+          continue;
+        }
+        out << i << ",  " << QString::number(static_cast<double>(i) * 0.5, 'f', 1) << ", Name" << i << "\r\n";
+      }
+      file.close();
+
+      // PrepFilter sizes the Attribute Matrix by the number of lines
+      data.numberOfLines = static_cast<int>(numLines);
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+      data.numberOfLines = static_cast<int>(numLines + 2);
+      QVariant var;
+      var.setValue(data);
+      importASCIIData->setProperty("WizardData", var);
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      if(pass == 1)
+      {
+        DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::CONVERSION_FAILURE)
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer intResults = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(DataArrayName));
+      DoubleArrayType::Pointer doubleResults = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Array2"));
+      DREAM3D_REQUIRE_VALID_POINTER(intResults.get())
+      StringDataArray::Pointer stringResults = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray("Array3"));
+      DREAM3D_REQUIRE_VALID_POINTER(doubleResults.get())
+      DREAM3D_REQUIRE_VALID_POINTER(stringResults.get())
+      DREAM3D_REQUIRE_EQUAL(intResults->getNumberOfTuples(), numLines)
+
+      for(size_t i = 0; i < numLines; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(intResults->getValue(i), static_cast<int32_t>(i))
+        DREAM3D_REQUIRE_EQUAL(doubleResults->getValue(i), static_cast<double>(i) * 0.5)
+        QString name = stringResults->getValue(i);
+        DREAM3D_REQUIRE_EQUAL(name, QString("Name%1").arg(i))
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -442,6 +525,7 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestLargeFile())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -7,6 +7,7 @@ set(TEST_${SUBDIR_NAME}_NAMES
   CombineAttributeMatricesTest
   ConditionalSetValueTest
   ConvertDataTest
+  CopyFeatureArrayToElementArrayTest
   CreateAttributeMatrixTest
   CreateDataArrayTest
   CreateDataContainerTest
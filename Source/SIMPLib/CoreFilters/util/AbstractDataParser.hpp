@@ -29,6 +29,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <type_traits>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -66,6 +68,19 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses a token given as the raw bytes [begin, end) of the input file. The default
+   * implementation builds a QString and calls the QString version.
+   * @param begin
+   * @param end
+   * @param index
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index)
+  {
+    return parse(QString::fromLocal8Bit(begin, static_cast<int>(end - begin)), index);
+  }
+
 protected:
   AbstractDataParser() :
   m_ColumnIndex(0)
@@ -122,6 +137,19 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index) override
+  {
+    ValueType value;
+    if(F::FastParse(begin, end, value))
+    {
+      ParserFunctor::ErrorObject obj;
+      obj.ok = true;
+      (*m_Ptr).setValue(index, value);
+      return obj;
+    }
+    return AbstractDataParser::parse(begin, end, index);
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
@@ -132,6 +160,8 @@ protected:
   }
 
 private:
+  using ValueType = typename std::result_of<F(const QString&, ParserFunctor::ErrorObject&)>::type;
+
   typename ArrayType::Pointer m_Ptr;
 
   public:
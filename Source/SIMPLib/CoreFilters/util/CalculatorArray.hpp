@@ -55,15 +55,23 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     ~CalculatorArray() override = default;
 
-    IDataArray::Pointer getArray() override { return m_Array; }
+    IDataArray::Pointer getArray() override
+    {
+      copySourceValues();
+      return m_Array;
+    }
+
+    IDataArray::Pointer getSourceArray() override { return m_SourceArray; }
 
     void setValue(int i, double val) override
     {
+      copySourceValues();
       m_Array->setValue(i, val);
     }
 
     double getValue(int i) override
     {
+      copySourceValues();
       if (m_Array->getNumberOfTuples() > 1)
       {
         return static_cast<double>(m_Array->getValue(i));
@@ -95,7 +103,7 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
           {
             for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
             {
-              newArray->setComponent(i, 0, m_Array->getComponent(i, c));
+              newArray->setComponent(i, 0, static_cast<double>(m_SourceArray->getComponent(i, c)));
             }
           }
 
@@ -119,21 +127,36 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate) :
       ICalculatorArray(),
-      m_Type(type)
+      m_SourceArray(dataArray),
+      m_Type(type),
+      m_CopyPending(allocate)
+    {
+      // The double precision copy is only made once something asks for it
+      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), false);
+    }
+
+    /**
+     * @brief copySourceValues Creates the double precision copy of the source array the first time it is needed
+     */
+    void copySourceValues()
     {
-      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-      if (allocate == true)
+      if (m_CopyPending == false)
       {
-        for (int i = 0; i < dataArray->getSize(); i++)
-        {
-          m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
-        }
+        return;
+      }
+      m_CopyPending = false;
+      m_Array = DoubleArrayType::CreateArray(m_SourceArray->getNumberOfTuples(), m_SourceArray->getComponentDimensions(), m_SourceArray->getName(), true);
+      for (size_t i = 0; i < m_SourceArray->getSize(); i++)
+      {
+        m_Array->setValue(i, static_cast<double>(m_SourceArray->getValue(i)));
       }
     }
 
   private:
+    typename DataArray<T>::Pointer                            m_SourceArray;
     DoubleArrayType::Pointer                                  m_Array;
     ValueType                                                 m_Type;
+    bool                                                      m_CopyPending;
 
     CalculatorArray(const CalculatorArray&); // Copy Constructor Not Implemented
     void operator=(const CalculatorArray&);  // Move assignment Not Implemented
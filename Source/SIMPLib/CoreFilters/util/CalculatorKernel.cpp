@@ -0,0 +1,567 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "CalculatorKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+#include "CoreFilters/util/ABSOperator.h"
+#include "CoreFilters/util/ACosOperator.h"
+#include "CoreFilters/util/ASinOperator.h"
+#include "CoreFilters/util/ATanOperator.h"
+#include "CoreFilters/util/AdditionOperator.h"
+#include "CoreFilters/util/CeilOperator.h"
+#include "CoreFilters/util/CosOperator.h"
+#include "CoreFilters/util/DivisionOperator.h"
+#include "CoreFilters/util/ExpOperator.h"
+#include "CoreFilters/util/FloorOperator.h"
+#include "CoreFilters/util/ICalculatorArray.h"
+#include "CoreFilters/util/LnOperator.h"
+#include "CoreFilters/util/Log10Operator.h"
+#include "CoreFilters/util/LogOperator.h"
+#include "CoreFilters/util/MultiplicationOperator.h"
+#include "CoreFilters/util/NegativeOperator.h"
+#include "CoreFilters/util/PowOperator.h"
+#include "CoreFilters/util/RootOperator.h"
+#include "CoreFilters/util/SinOperator.h"
+#include "CoreFilters/util/SqrtOperator.h"
+#include "CoreFilters/util/SubtractionOperator.h"
+#include "CoreFilters/util/TanOperator.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+// Number of values evaluated per instruction before moving on to the next instruction. Small enough
+// that the stack buffers stay in cache, large enough that the per instruction overhead is negligible.
+const size_t k_BlockSize = 1024;
+
+template <typename T> void LoadValues(const void* input, size_t offset, size_t count, double* values)
+{
+  const T* data = static_cast<const T*>(input) + offset;
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = static_cast<double>(data[i]);
+  }
+}
+
+template <typename T> void StoreValues(const double* values, size_t count, void* output, size_t offset)
+{
+  T* data = static_cast<T*>(output) + offset;
+  for(size_t i = 0; i < count; i++)
+  {
+    data[i] = values[i];
+  }
+}
+
+template <typename T> bool GetLoadFunc(IDataArray::Pointer array, CalculatorKernel::LoadFunc& load)
+{
+  if(nullptr == std::dynamic_pointer_cast<DataArray<T>>(array))
+  {
+    return false;
+  }
+  load = LoadValues<T>;
+  return true;
+}
+
+template <typename T> IDataArray::Pointer CreateOutputArray(size_t numTuples, const QVector<size_t>& cDims, const QString& name, void*& output, CalculatorKernel::StoreFunc& store)
+{
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, cDims, name);
+  if(nullptr == array)
+  {
+    return IDataArray::NullPointer();
+  }
+  output = array->getVoidPointer(0);
+  store = StoreValues<T>;
+  return array;
+}
+
+template <typename Func> void ApplyUnary(double* a, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    a[i] = func(a[i]);
+  }
+}
+
+template <typename Func> void ApplyBinary(double* a, const double* b, size_t count, Func func)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    a[i] = func(a[i], b[i]);
+  }
+}
+} // namespace
+
+/**
+ * @brief The EvaluateCalculatorKernelImpl class evaluates a range of values of a compiled expression
+ */
+class EvaluateCalculatorKernelImpl
+{
+public:
+  EvaluateCalculatorKernelImpl(const CalculatorKernel* kernel)
+  : m_Kernel(kernel)
+  {
+  }
+  virtual ~EvaluateCalculatorKernelImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    m_Kernel->evaluate(start, end);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const CalculatorKernel* m_Kernel;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::~CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::addLeaf(IDataArray::Pointer array, bool constant)
+{
+  Leaf leaf;
+  leaf.array = array;
+  leaf.data = array->getVoidPointer(0);
+  leaf.load = nullptr;
+  leaf.constant = constant;
+  leaf.value = 0.0;
+
+  bool found = GetLoadFunc<float>(array, leaf.load) || GetLoadFunc<double>(array, leaf.load) || GetLoadFunc<int8_t>(array, leaf.load) || GetLoadFunc<uint8_t>(array, leaf.load) ||
+               GetLoadFunc<int16_t>(array, leaf.load) || GetLoadFunc<uint16_t>(array, leaf.load) || GetLoadFunc<int32_t>(array, leaf.load) || GetLoadFunc<uint32_t>(array, leaf.load) ||
+               GetLoadFunc<int64_t>(array, leaf.load) || GetLoadFunc<uint64_t>(array, leaf.load) || GetLoadFunc<bool>(array, leaf.load);
+  if(!found)
+  {
+    return false;
+  }
+
+  if(constant && nullptr != leaf.data)
+  {
+    leaf.load(leaf.data, 0, 1, &leaf.value);
+  }
+
+  m_Instructions.push_back({OpCode::Load, m_Leaves.size()});
+  m_Leaves.push_back(leaf);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::compile(const QVector<CalculatorItem::Pointer>& rpn, bool degrees)
+{
+  m_Instructions.clear();
+  m_Leaves.clear();
+  m_StackDepth = 0;
+  m_NumTuples = 1;
+  m_ComponentDims = QVector<size_t>(1, 1);
+  m_Degrees = degrees;
+
+  bool hasArray = false;
+  size_t depth = 0;
+  for(const CalculatorItem::Pointer& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      IDataArray::Pointer array = calcArray->getSourceArray();
+      if(nullptr == array || !array->isAllocated())
+      {
+        return false;
+      }
+      // Arrays with a single tuple provide the same value for every index
+      bool constant = array->getNumberOfTuples() <= 1;
+      if(calcArray->getType() == ICalculatorArray::Array && !hasArray)
+      {
+        hasArray = true;
+        m_NumTuples = array->getNumberOfTuples();
+        m_ComponentDims = array->getComponentDimensions();
+      }
+      if(!addLeaf(array, constant))
+      {
+        return false;
+      }
+      depth++;
+      m_StackDepth = std::max(m_StackDepth, depth);
+      continue;
+    }
+
+    OpCode op;
+    size_t numArgs = 1;
+    if(nullptr != std::dynamic_pointer_cast<AdditionOperator>(item))
+    {
+      op = OpCode::Add;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SubtractionOperator>(item))
+    {
+      op = OpCode::Subtract;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<MultiplicationOperator>(item))
+    {
+      op = OpCode::Multiply;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<DivisionOperator>(item))
+    {
+      op = OpCode::Divide;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<PowOperator>(item))
+    {
+      op = OpCode::Pow;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LogOperator>(item))
+    {
+      op = OpCode::Log;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<RootOperator>(item))
+    {
+      op = OpCode::Root;
+      numArgs = 2;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<NegativeOperator>(item))
+    {
+      op = OpCode::Negative;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ABSOperator>(item))
+    {
+      op = OpCode::Abs;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<CeilOperator>(item))
+    {
+      op = OpCode::Ceil;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<FloorOperator>(item))
+    {
+      op = OpCode::Floor;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ExpOperator>(item))
+    {
+      op = OpCode::Exp;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<LnOperator>(item))
+    {
+      op = OpCode::Ln;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<Log10Operator>(item))
+    {
+      op = OpCode::Log10;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SqrtOperator>(item))
+    {
+      op = OpCode::Sqrt;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<SinOperator>(item))
+    {
+      op = OpCode::Sin;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<CosOperator>(item))
+    {
+      op = OpCode::Cos;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<TanOperator>(item))
+    {
+      op = OpCode::Tan;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ASinOperator>(item))
+    {
+      op = OpCode::ASin;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ACosOperator>(item))
+    {
+      op = OpCode::ACos;
+    }
+    else if(nullptr != std::dynamic_pointer_cast<ATanOperator>(item))
+    {
+      op = OpCode::ATan;
+    }
+    else
+    {
+      return false;
+    }
+
+    if(depth < numArgs)
+    {
+      return false;
+    }
+    depth -= (numArgs - 1);
+    m_Instructions.push_back({op, 0});
+  }
+
+  if(depth != 1)
+  {
+    return false;
+  }
+
+  // Every array that is not a single value must line up with the output
+  size_t numValues = m_NumTuples;
+  for(size_t d : m_ComponentDims)
+  {
+    numValues *= d;
+  }
+  for(const Leaf& leaf : m_Leaves)
+  {
+    if(!leaf.constant && leaf.array->getSize() != numValues)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CalculatorKernel::execute(SIMPL::ScalarTypes::Type scalarType, const QString& name)
+{
+  IDataArray::Pointer output = IDataArray::NullPointer();
+  switch(scalarType)
+  {
+  case SIMPL::ScalarTypes::Type::Int8:
+    output = CreateOutputArray<int8_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::UInt8:
+    output = CreateOutputArray<uint8_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Int16:
+    output = CreateOutputArray<int16_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::UInt16:
+    output = CreateOutputArray<uint16_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Int32:
+    output = CreateOutputArray<int32_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::UInt32:
+    output = CreateOutputArray<uint32_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Int64:
+    output = CreateOutputArray<int64_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::UInt64:
+    output = CreateOutputArray<uint64_t>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Float:
+    output = CreateOutputArray<float>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Double:
+    output = CreateOutputArray<double>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  case SIMPL::ScalarTypes::Type::Bool:
+    output = CreateOutputArray<bool>(m_NumTuples, m_ComponentDims, name, m_Output, m_Store);
+    break;
+  default:
+    break;
+  }
+
+  if(nullptr == output)
+  {
+    return output;
+  }
+
+  size_t numValues = output->getSize();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numValues, k_BlockSize), EvaluateCalculatorKernelImpl(this), tbb::auto_partitioner());
+    });
+  }
+  else
+#endif
+  {
+    EvaluateCalculatorKernelImpl serial(this);
+    serial.generate(0, numValues);
+  }
+
+  m_Output = nullptr;
+  m_Store = nullptr;
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorKernel::evaluate(size_t start, size_t end) const
+{
+  bool degrees = m_Degrees;
+  std::vector<double> buffer(m_StackDepth * k_BlockSize);
+  for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
+  {
+    size_t count = std::min(k_BlockSize, end - blockStart);
+    size_t top = 0;
+    for(const Instruction& instruction : m_Instructions)
+    {
+      if(instruction.op == OpCode::Load)
+      {
+        const Leaf& leaf = m_Leaves[instruction.leaf];
+        double* values = buffer.data() + top * k_BlockSize;
+        if(leaf.constant)
+        {
+          std::fill(values, values + count, leaf.value);
+        }
+        else
+        {
+          leaf.load(leaf.data, blockStart, count, values);
+        }
+        top++;
+        continue;
+      }
+
+      // The left operand of a binary operator is the value below the top of the stack
+      double* a = buffer.data() + (top - 1) * k_BlockSize;
+      switch(instruction.op)
+      {
+      case OpCode::Add:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double x, double y) { return x + y; });
+        top--;
+        break;
+      case OpCode::Subtract:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double x, double y) { return x - y; });
+        top--;
+        break;
+      case OpCode::Multiply:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double x, double y) { return x * y; });
+        top--;
+        break;
+      case OpCode::Divide:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double x, double y) { return x / y; });
+        top--;
+        break;
+      case OpCode::Pow:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double x, double y) { return pow(x, y); });
+        top--;
+        break;
+      case OpCode::Log:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double base, double value) { return log(value) / log(base); });
+        top--;
+        break;
+      case OpCode::Root:
+        a -= k_BlockSize;
+        ApplyBinary(a, a + k_BlockSize, count, [](double base, double root) { return root == 0 ? std::numeric_limits<double>().infinity() : pow(base, 1 / root); });
+        top--;
+        break;
+      case OpCode::Negative:
+        ApplyUnary(a, count, [](double x) { return -1 * x; });
+        break;
+      case OpCode::Abs:
+        ApplyUnary(a, count, [](double x) { return fabs(x); });
+        break;
+      case OpCode::Ceil:
+        ApplyUnary(a, count, [](double x) { return ceil(x); });
+        break;
+      case OpCode::Floor:
+        ApplyUnary(a, count, [](double x) { return floor(x); });
+        break;
+      case OpCode::Exp:
+        ApplyUnary(a, count, [](double x) { return exp(x); });
+        break;
+      case OpCode::Ln:
+        ApplyUnary(a, count, [](double x) { return log(x); });
+        break;
+      case OpCode::Log10:
+        ApplyUnary(a, count, [](double x) { return log10(x); });
+        break;
+      case OpCode::Sqrt:
+        ApplyUnary(a, count, [](double x) { return sqrt(x); });
+        break;
+      case OpCode::Sin:
+        ApplyUnary(a, count, [degrees](double x) { return sin(degrees ? CalculatorOperator::toRadians(x) : x); });
+        break;
+      case OpCode::Cos:
+        ApplyUnary(a, count, [degrees](double x) { return cos(degrees ? CalculatorOperator::toRadians(x) : x); });
+        break;
+      case OpCode::Tan:
+        ApplyUnary(a, count, [degrees](double x) { return tan(degrees ? CalculatorOperator::toRadians(x) : x); });
+        break;
+      case OpCode::ASin:
+        ApplyUnary(a, count, [degrees](double x) { return degrees ? CalculatorOperator::toDegrees(asin(x)) : asin(x); });
+        break;
+      case OpCode::ACos:
+        ApplyUnary(a, count, [degrees](double x) { return degrees ? CalculatorOperator::toDegrees(acos(x)) : acos(x); });
+        break;
+      case OpCode::ATan:
+        ApplyUnary(a, count, [degrees](double x) { return degrees ? CalculatorOperator::toDegrees(atan(x)) : atan(x); });
+        break;
+      default:
+        break;
+      }
+    }
+
+    m_Store(buffer.data(), count, m_Output, blockStart);
+  }
+}
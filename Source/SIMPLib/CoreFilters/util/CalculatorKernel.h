@@ -0,0 +1,148 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "CalculatorItem.h"
+
+/**
+ * @brief The CalculatorKernel class compiles an RPN expression from the ArrayCalculator into a flat list
+ * of instructions and evaluates the whole expression for one block of values at a time. Only a block sized
+ * buffer per stack level is needed, so no full size temporary arrays are created. Input arrays are read
+ * in their native type and the result is written directly in the output type.
+ */
+class SIMPLib_EXPORT CalculatorKernel
+{
+  public:
+    enum class OpCode
+    {
+      Load,
+      Add,
+      Subtract,
+      Multiply,
+      Divide,
+      Pow,
+      Log,
+      Root,
+      Negative,
+      Abs,
+      Ceil,
+      Floor,
+      Exp,
+      Ln,
+      Log10,
+      Sqrt,
+      Sin,
+      Cos,
+      Tan,
+      ASin,
+      ACos,
+      ATan
+    };
+
+    CalculatorKernel();
+    virtual ~CalculatorKernel();
+
+    /**
+     * @brief compile Converts the RPN expression into instructions
+     * @param rpn The expression in RPN order
+     * @param degrees True if the trigonometric operators work in degrees
+     * @return False if the expression contains an item the kernel cannot evaluate or is not
+     * a valid expression. The caller should fall back to evaluating the operators one at a time.
+     */
+    bool compile(const QVector<CalculatorItem::Pointer>& rpn, bool degrees);
+
+    /**
+     * @brief execute Evaluates the compiled expression
+     * @param scalarType The type of the output array
+     * @param name The name of the output array
+     * @return The output array or a null pointer if the type is not supported
+     */
+    IDataArray::Pointer execute(SIMPL::ScalarTypes::Type scalarType, const QString& name);
+
+    /**
+     * @brief evaluate Evaluates the values in the range [start, end) into the output array that
+     * execute() is filling. This is called by the threads that execute() starts.
+     * @param start
+     * @param end
+     */
+    void evaluate(size_t start, size_t end) const;
+
+    using LoadFunc = void (*)(const void* input, size_t offset, size_t count, double* values);
+    using StoreFunc = void (*)(const double* values, size_t count, void* output, size_t offset);
+
+  private:
+    struct Instruction
+    {
+      OpCode op;
+      size_t leaf;
+    };
+
+    struct Leaf
+    {
+      IDataArray::Pointer array;
+      const void* data;
+      LoadFunc load;
+      bool constant;
+      double value;
+    };
+
+    std::vector<Instruction> m_Instructions;
+    std::vector<Leaf> m_Leaves;
+    size_t m_StackDepth = 0;
+    size_t m_NumTuples = 1;
+    QVector<size_t> m_ComponentDims;
+    bool m_Degrees = false;
+
+    void* m_Output = nullptr;
+    StoreFunc m_Store = nullptr;
+
+    bool addLeaf(IDataArray::Pointer array, bool constant);
+
+  public:
+    CalculatorKernel(const CalculatorKernel&) = delete;            // Copy Constructor Not Implemented
+    CalculatorKernel(CalculatorKernel&&) = delete;                 // Move Constructor Not Implemented
+    CalculatorKernel& operator=(const CalculatorKernel&) = delete; // Copy Assignment Not Implemented
+    CalculatorKernel& operator=(CalculatorKernel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -57,6 +57,13 @@ class SIMPLib_EXPORT ICalculatorArray : public CalculatorItem
     ~ICalculatorArray() override;
 
     virtual IDataArray::Pointer getArray() = 0;
+
+    /**
+     * @brief getSourceArray Returns the array this item was created from in its native type. Unlike
+     * getArray() this never creates the double precision copy of the values.
+     * @return
+     */
+    virtual IDataArray::Pointer getSourceArray() = 0;
     virtual double getValue(int i) = 0;
     virtual void setValue(int i, double value) = 0;
     virtual ValueType getType() = 0;
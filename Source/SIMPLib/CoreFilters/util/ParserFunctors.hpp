@@ -34,6 +34,7 @@
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/AsciiNumberParser.h"
 
 namespace ParserErrorMessages
 {
@@ -54,6 +55,20 @@ public:
     bool ok;
     QString errorMessage;
   };
+
+  /**
+   * @brief Converts a token straight from the bytes in [begin, end). This only handles the plain
+   * decimal tokens that make up nearly every file; when it returns false the caller must convert
+   * the token with the functor's operator() so that the original rules and error messages apply.
+   * @param begin
+   * @param end
+   * @param value
+   * @return
+   */
+  template <typename T> static bool FastParse(const char* begin, const char* end, T& value)
+  {
+    return AsciiNumberParser::Parse<T>(begin, end, value);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -64,6 +79,24 @@ class Int8Functor : public ParserFunctor
 public:
   ~Int8Functor() override = default;
 
+  /**
+   * @brief Int8 tokens are converted with base 0, so anything with a leading zero (octal or
+   * hexadecimal) is left to operator()
+   */
+  static bool FastParse(const char* begin, const char* end, int8_t& value)
+  {
+    const char* digit = begin;
+    while(digit != end && (*digit == ' ' || *digit == '\t' || *digit == '-' || *digit == '+'))
+    {
+      ++digit;
+    }
+    if(digit != end && *digit == '0' && (digit + 1) != end && *(digit + 1) != ' ' && *(digit + 1) != '\t')
+    {
+      return false;
+    }
+    return AsciiNumberParser::Parse<int8_t>(begin, end, value);
+  }
+
   int8_t operator()(const QString& token, ErrorObject& obj)
   {
     int16_t value = token.toInt(&obj.ok, 0);
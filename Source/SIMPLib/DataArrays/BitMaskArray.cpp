@@ -0,0 +1,827 @@
+/* ============================================================================
+ * Copyright (c) 2009-2018 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BitMaskArray.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <QtCore/QLocale>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t WordCount(size_t numTuples)
+{
+  return (numTuples + BitMaskArray::k_BitsPerWord - 1) / BitMaskArray::k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PopCount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return static_cast<size_t>(__popcnt64(word));
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// The word must not be zero
+// -----------------------------------------------------------------------------
+size_t LowestSetBit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index = 0;
+  _BitScanForward64(&index, word);
+  return static_cast<size_t>(index);
+#else
+  return PopCount((word & (~word + 1)) - 1);
+#endif
+}
+} // namespace
+
+const size_t BitMaskArray::k_BitsPerWord;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray()
+: m_Name("")
+, m_NumTuples(0)
+, m_OwnsData(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::BitMaskArray(size_t numTuples, const QString& name, bool allocate)
+: m_Name(name)
+, m_NumTuples(numTuples)
+, m_OwnsData(true)
+{
+  if(allocate)
+  {
+    m_Words.resize(WordCount(numTuples), 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::~BitMaskArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return NullPointer();
+  }
+  Pointer ptr(new BitMaskArray(numTuples, name, allocate));
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::CreateArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate)
+{
+  SIMPL_NOT_USED(compDims);
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::Pointer BitMaskArray::FromBoolArray(const BoolArrayType::Pointer& boolArray)
+{
+  if(nullptr == boolArray.get() || boolArray->getNumberOfComponents() != 1)
+  {
+    return NullPointer();
+  }
+  size_t numTuples = boolArray->getNumberOfTuples();
+  bool allocated = boolArray->isAllocated();
+  Pointer ptr = CreateArray(numTuples, boolArray->getName(), allocated);
+  if(nullptr != ptr.get() && allocated && numTuples > 0)
+  {
+    ptr->setValues(0, boolArray->getPointer(0), numTuples);
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitMaskArray::toBoolArray()
+{
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, m_Name, isAllocated());
+  if(nullptr != boolArray.get() && isAllocated() && m_NumTuples > 0)
+  {
+    getValues(0, boolArray->getPointer(0), m_NumTuples);
+  }
+  return boolArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate)
+{
+  SIMPL_NOT_USED(rank);
+  SIMPL_NOT_USED(dims);
+  IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate)
+{
+  SIMPL_NOT_USED(dims);
+  IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate)
+{
+  SIMPL_NOT_USED(dims);
+  IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::isAllocated()
+{
+  return m_Words.size() == WordCount(m_NumTuples);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+{
+  xdmfTypeName = getNameOfClass();
+  precision = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getTypeAsString()
+{
+  return "BitMaskArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::setName(const QString& name)
+{
+  m_Name = name;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getName()
+{
+  return m_Name;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::takeOwnership()
+{
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::releaseOwnership()
+{
+  m_OwnsData = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitMaskArray::getVoidPointer(size_t i)
+{
+  // Only the start of the packed words is addressable, a single bit has no address of its own
+  if(i > 0 || m_Words.empty())
+  {
+    return nullptr;
+  }
+  return static_cast<void*>(m_Words.data());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfTuples()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getSize()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::getNumberOfComponents()
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> BitMaskArray::getComponentDimensions()
+{
+  QVector<size_t> dims(1, 1);
+  return dims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getTypeSize()
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::eraseTuples(QVector<size_t>& idxs)
+{
+  // If nothing is to be erased just return
+  if(idxs.empty())
+  {
+    return 0;
+  }
+  if(static_cast<size_t>(idxs.size()) >= m_NumTuples)
+  {
+    resize(0);
+    return 0;
+  }
+
+  // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+  // off the end of the array and return an error code.
+  for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+  {
+    if(idxs[i] >= m_NumTuples)
+    {
+      return -100;
+    }
+  }
+
+  // The indices do not need to be sorted or unique
+  std::unique_ptr<bool[]> keep(new bool[m_NumTuples]);
+  std::fill(keep.get(), keep.get() + m_NumTuples, true);
+  for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+  {
+    keep[idxs[i]] = false;
+  }
+  if(compactTuples(keep.get()) < 0)
+  {
+    return -101;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t BitMaskArray::compactTuples(const bool* mask)
+{
+  if(!isAllocated())
+  {
+    return -1;
+  }
+
+  // The kept bits are packed toward the front one source word at a time. The output never gets
+  // ahead of the input so the words are rewritten in place. A word that is kept whole is shifted
+  // in as a unit.
+  size_t numTuples = m_NumTuples;
+  size_t destWord = 0;
+  WordType pending = 0;
+  size_t pendingBits = 0;
+  for(size_t w = 0; w < m_Words.size(); w++)
+  {
+    size_t first = w * k_BitsPerWord;
+    size_t end = std::min(k_BitsPerWord, numTuples - first);
+    const bool* wordMask = mask + first;
+    WordType word = m_Words[w];
+    if(end == k_BitsPerWord && std::all_of(wordMask, wordMask + end, [](bool value) { return value; }))
+    {
+      m_Words[destWord++] = pending | (word << pendingBits);
+      pending = (pendingBits == 0) ? 0 : word >> (k_BitsPerWord - pendingBits);
+      continue;
+    }
+    for(size_t b = 0; b < end; b++)
+    {
+      if(!wordMask[b])
+      {
+        continue;
+      }
+      pending |= ((word >> b) & 1) << pendingBits;
+      if(++pendingBits == k_BitsPerWord)
+      {
+        m_Words[destWord++] = pending;
+        pending = 0;
+        pendingBits = 0;
+      }
+    }
+  }
+
+  size_t numKept = destWord * k_BitsPerWord + pendingBits;
+  if(pendingBits > 0)
+  {
+    m_Words[destWord] = pending;
+  }
+  m_NumTuples = numKept;
+  m_Words.resize(WordCount(m_NumTuples));
+  clearTrailingBits();
+  return static_cast<int64_t>(numTuples - numKept);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  setValue(newPos, getValue(currentPos));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(!isAllocated() || nullptr == sourceArray.get() || !sourceArray->isAllocated())
+  {
+    return false;
+  }
+  if(sourceArray->getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(totalSrcTuples + destTupleOffset > m_NumTuples)
+  {
+    return false;
+  }
+
+  if(Self* source = dynamic_cast<Self*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, source->getValue(srcTupleOffset + i));
+    }
+    return true;
+  }
+  if(BoolArrayType* source = dynamic_cast<BoolArrayType*>(sourceArray.get()))
+  {
+    if(totalSrcTuples > 0)
+    {
+      setValues(destTupleOffset, source->getPointer(srcTupleOffset), totalSrcTuples);
+    }
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeTuple(size_t pos, void* value)
+{
+  setValue(pos, *(reinterpret_cast<bool*>(value)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithZeros()
+{
+  std::fill(m_Words.begin(), m_Words.end(), 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initializeWithValue(bool value)
+{
+  std::fill(m_Words.begin(), m_Words.end(), value ? ~static_cast<WordType>(0) : 0);
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitMaskArray::deepCopy(bool forceNoAllocate)
+{
+  BitMaskArray::Pointer daCopy = BitMaskArray::CreateArray(m_NumTuples, getName(), !forceNoAllocate);
+  if(!forceNoAllocate && isAllocated())
+  {
+    daCopy->m_Words = m_Words;
+  }
+  return daCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::resizeTotalElements(size_t size)
+{
+  return resize(size);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitMaskArray::resize(size_t numTuples)
+{
+  m_Words.resize(WordCount(numTuples), 0);
+  m_NumTuples = numTuples;
+  clearTrailingBits();
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::initialize()
+{
+  m_Words.clear();
+  m_NumTuples = 0;
+  m_OwnsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::clearTrailingBits()
+{
+  size_t used = m_NumTuples % k_BitsPerWord;
+  if(used != 0 && !m_Words.empty())
+  {
+    m_Words.back() &= (static_cast<WordType>(1) << used) - 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printTuple(QTextStream& out, size_t i, char delimiter)
+{
+  SIMPL_NOT_USED(delimiter);
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::printComponent(QTextStream& out, size_t i, int j)
+{
+  SIMPL_NOT_USED(j);
+  out << (getValue(i) ? 1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getFullNameOfClass()
+{
+  return "BitMaskArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeH5Data(hid_t parentId, QVector<size_t> tDims)
+{
+  if(!isAllocated())
+  {
+    return -85;
+  }
+  // The words are written as a flat dataset. The tuple dimensions of the mask are only
+  // recorded in the attributes.
+  int32_t rank = 1;
+  hsize_t dims[1] = {static_cast<hsize_t>(m_Words.size())};
+  WordType zero = 0;
+  WordType* words = m_Words.empty() ? &zero : m_Words.data();
+  dims[0] = m_Words.empty() ? 1 : dims[0];
+
+  herr_t err = 0;
+  if(!QH5Lite::datasetExists(parentId, getName()))
+  {
+    err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, words);
+  }
+  else
+  {
+    err = QH5Lite::replacePointerDataset(parentId, getName(), rank, dims, words);
+  }
+  if(err < 0)
+  {
+    return err;
+  }
+  QVector<size_t> cDims(1, 1);
+  return H5DataArrayWriter::writeDataArrayAttributes<BitMaskArray>(parentId, this, tDims, cDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label)
+{
+  SIMPL_NOT_USED(volDims);
+  SIMPL_NOT_USED(hdfFileName);
+  SIMPL_NOT_USED(groupPath);
+  SIMPL_NOT_USED(label);
+  out << "<!-- Xdmf is not supported for " << getNameOfClass() << " with type " << getTypeAsString() << " --> ";
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitMaskArray::getInfoString(SIMPL::InfoStringFormat format)
+{
+  QString info;
+  QTextStream ss(&info);
+  if(format == SIMPL::HtmlFormat)
+  {
+    ss << "<html><head></head>\n";
+    ss << "<body>\n";
+    ss << "<table cellpadding=\"4\" cellspacing=\"0\" border=\"0\">\n";
+    ss << "<tbody>\n";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th colspan=2>Attribute Array Info</th></tr>";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Name:</th><td>" << getName() << "</td></tr>";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Type:</th><td>" << getTypeAsString() << "</td></tr>";
+    QLocale usa(QLocale::English, QLocale::UnitedStates);
+    QString numStr = usa.toString(static_cast<qlonglong>(getNumberOfTuples()));
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Number of Tuples:</th><td>" << numStr << "</td></tr>";
+    QString memSizeStr = usa.toString(static_cast<qlonglong>(m_Words.size() * sizeof(WordType)));
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Memory Size:</th><td>" << memSizeStr << " bytes</td></tr>";
+    ss << "</tbody></table>\n";
+    ss << "<br/>";
+    ss << "</body></html>";
+  }
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitMaskArray::readH5Data(hid_t parentId)
+{
+  QVector<size_t> tDims;
+  int err = QH5Lite::readVectorAttribute(parentId, getName(), SIMPL::HDF5::TupleDimensions, tDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+  QVector<hsize_t> dims;
+  H5T_class_t typeClass;
+  size_t typeSize = 0;
+  err = QH5Lite::getDatasetInfo(parentId, getName(), dims, typeClass, typeSize);
+  if(err < 0)
+  {
+    return err;
+  }
+  size_t numWords = WordCount(numTuples);
+  if(dims.size() != 1 || typeSize != sizeof(WordType) || dims[0] < numWords)
+  {
+    return -86;
+  }
+
+  std::vector<WordType> words(static_cast<size_t>(dims[0]), 0);
+  err = QH5Lite::readPointerDataset(parentId, getName(), words.data());
+  if(err < 0)
+  {
+    return err;
+  }
+  words.resize(numWords);
+  m_Words.swap(words);
+  m_NumTuples = numTuples;
+  clearTrailingBits();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::setValues(size_t start, const bool* values, size_t count)
+{
+  size_t i = 0;
+  // Leading bits up to the first word boundary
+  while(i < count && (start + i) % k_BitsPerWord != 0)
+  {
+    setValue(start + i, values[i]);
+    i++;
+  }
+  // Whole words are packed in a register and stored once
+  for(; i + k_BitsPerWord <= count; i += k_BitsPerWord)
+  {
+    WordType word = 0;
+    for(size_t b = 0; b < k_BitsPerWord; b++)
+    {
+      word |= static_cast<WordType>(values[i + b] ? 1 : 0) << b;
+    }
+    m_Words[(start + i) / k_BitsPerWord] = word;
+  }
+  for(; i < count; i++)
+  {
+    setValue(start + i, values[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::getValues(size_t start, bool* values, size_t count) const
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = getValue(start + i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::countSetBits() const
+{
+  size_t count = 0;
+  for(const WordType& word : m_Words)
+  {
+    count += PopCount(word);
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::findNextSetBit(size_t start) const
+{
+  if(start >= m_NumTuples)
+  {
+    return m_NumTuples;
+  }
+  size_t w = start / k_BitsPerWord;
+  WordType word = m_Words[w] & (~static_cast<WordType>(0) << (start % k_BitsPerWord));
+  while(word == 0)
+  {
+    w++;
+    if(w >= m_Words.size())
+    {
+      return m_NumTuples;
+    }
+    word = m_Words[w];
+  }
+  return w * k_BitsPerWord + LowestSetBit(word);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseAnd(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  for(size_t w = 0; w < m_Words.size(); w++)
+  {
+    m_Words[w] &= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitMaskArray::bitwiseOr(const BitMaskArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  for(size_t w = 0; w < m_Words.size(); w++)
+  {
+    m_Words[w] |= other.m_Words[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitMaskArray::invert()
+{
+  for(WordType& word : m_Words)
+  {
+    word = ~word;
+  }
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitMaskArray::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitMaskArray::WordType* BitMaskArray::getWordPointer(size_t i)
+{
+  return m_Words.data() + i;
+}
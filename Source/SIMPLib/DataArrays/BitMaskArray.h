@@ -0,0 +1,477 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "H5Support/H5Lite.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class BitMaskArray BitMaskArray.h SIMPLib/DataArrays/BitMaskArray.h
+ * @brief Stores a scalar boolean mask with one bit per tuple. The bits are packed into 64 bit
+ * words, tuple i being bit (i % 64) of word (i / 64), and the unused bits of the last word are
+ * always zero. Counting and combining masks works a word at a time.
+ *
+ * A BitMaskArray converts to and from a BoolArrayType (DataArray<bool>) for the filters that
+ * consume one byte per tuple masks. It is written to HDF5 as a 1D dataset of its words with the
+ * usual DataArray attributes and an ObjectType of "BitMaskArray".
+ */
+class SIMPLib_EXPORT BitMaskArray : public IDataArray
+{
+public:
+  SIMPL_SHARED_POINTERS(BitMaskArray)
+  SIMPL_TYPE_MACRO_SUPER(BitMaskArray, IDataArray)
+  SIMPL_CLASS_VERSION(1)
+
+  using WordType = uint64_t;
+  static const size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param compDims NOT USED. A mask always has 1 component.
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Packs a scalar DataArray<bool> into a new BitMaskArray with the same name
+   * @param boolArray
+   * @return Null if the array is null or has more than 1 component
+   */
+  static Pointer FromBoolArray(const BoolArrayType::Pointer& boolArray);
+
+  /**
+   * @brief Unpacks this mask into a new DataArray<bool> with the same name
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray();
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param rank NOT USED. It is always 1.
+   * @param dims NOT USED.
+   * @param name
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param dims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param dims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief ~BitMaskArray
+   */
+  ~BitMaskArray() override;
+
+  /**
+   * @brief isAllocated
+   * @return
+   */
+  bool isAllocated() override;
+
+  /**
+   * @brief GetTypeName Returns a string representation of the type of data that is stored by this class. This
+   * can be a primitive like char, float, int or the name of a class.
+   * @return
+   */
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) override;
+
+  /**
+   * @brief getTypeAsString
+   * @return
+   */
+  QString getTypeAsString() override;
+
+  /**
+   * @brief Gives this array a human readable name
+   * @param name The name of this array
+   */
+  void setName(const QString& name) override;
+
+  /**
+   * @brief Returns the human readable name of this array
+   * @return
+   */
+  QString getName() override;
+
+  /**
+   * @brief
+   */
+  void takeOwnership() override;
+
+  /**
+   * @brief
+   */
+  void releaseOwnership() override;
+
+  /**
+   * @brief Returns a void pointer to the first word of the packed bits when i is 0. Single bits
+   * are not addressable, so any other index returns nullptr. Use getWordPointer() to reach the
+   * word that holds a given tuple.
+   * @param i The index of the tuple, which must be 0
+   * @return Void Pointer. Possibly nullptr.
+   */
+  void* getVoidPointer(size_t i) override;
+
+  /**
+   * @brief Returns the number of Tuples in the array.
+   */
+  size_t getNumberOfTuples() override;
+
+  /**
+   * @brief Return the number of elements in the array
+   * @return
+   */
+  size_t getSize() override;
+
+  int getNumberOfComponents() override;
+
+  QVector<size_t> getComponentDimensions() override;
+
+  /**
+   * @brief Returns 1. The values are packed 8 to a byte, so this is an upper bound on the memory
+   * that each value uses and not the stride between values. getNumberOfWords() * sizeof(WordType)
+   * is the number of bytes behind getVoidPointer(0).
+   */
+  size_t getTypeSize() override;
+
+  /**
+   * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
+   * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
+   * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
+   * returned from the program.
+   * @param idxs The indices to remove
+   * @return error code.
+   */
+  int eraseTuples(QVector<size_t>& idxs) override;
+
+  /**
+   * @brief Keeps the tuples whose mask value is true, in their current order, by packing their
+   * bits toward the front of the words in place.
+   * @param mask One value per tuple
+   * @return The number of tuples that were removed, or -1 if the array is not allocated
+   */
+  int64_t compactTuples(const bool* mask) override;
+
+  /**
+   * @brief Copies a Tuple from one position to another.
+   * @param currentPos The index of the source data
+   * @param newPos The destination index to place the copied data
+   * @return
+   */
+  int copyTuple(size_t currentPos, size_t newPos) override;
+
+  // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+  // This is required so that other classes can call this version of copyData from the subclasses.
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Copies totalSrcTuples tuples starting at srcTupleOffset from the source into this
+   * array starting at destTupleOffset. The source may be a BitMaskArray or a scalar DataArray<bool>.
+   * @param destTupleOffset
+   * @param sourceArray
+   * @param srcTupleOffset
+   * @param totalSrcTuples
+   * @return
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Sets the value of a tuple
+   * @param pos The index of the Tuple
+   * @param value pointer to a bool
+   */
+  void initializeTuple(size_t pos, void* value) override;
+
+  /**
+   * @brief Sets all the values to false.
+   */
+  void initializeWithZeros() override;
+
+  /**
+   * @brief Sets all the values to the given value
+   * @param value
+   */
+  virtual void initializeWithValue(bool value);
+
+  /**
+   * @brief deepCopy
+   * @param forceNoAllocate
+   * @return
+   */
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override;
+
+  /**
+   * @brief Resizes the internal array
+   * @param size The new size of the internal array
+   * @return 1 on success, 0 on failure
+   */
+  int32_t resizeTotalElements(size_t size) override;
+
+  /**
+   * @brief Resizes the internal array. New tuples are false.
+   * @param numTuples The new number of tuples
+   * @return 1 on success, 0 on failure
+   */
+  int32_t resize(size_t numTuples) override;
+
+  /**
+   * @brief Initializes this class to zero bytes freeing any data that it currently owns
+   */
+  virtual void initialize();
+
+  /**
+   * @brief printTuple
+   * @param out
+   * @param i
+   * @param delimiter
+   */
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') override;
+
+  /**
+   * @brief printComponent
+   * @param out
+   * @param i
+   * @param j
+   */
+  void printComponent(QTextStream& out, size_t i, int j) override;
+
+  /**
+   * @brief getFullNameOfClass
+   * @return
+   */
+  QString getFullNameOfClass();
+
+  /**
+   * @brief writeH5Data
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int writeH5Data(hid_t parentId, QVector<size_t> tDims) override;
+
+  /**
+   * @brief writeXdmfAttribute
+   * @param out
+   * @param volDims
+   * @param hdfFileName
+   * @param groupPath
+   * @return
+   */
+  int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) override;
+
+  /**
+   * @brief getInfoString
+   * @return Returns a formatted string that contains general infomation about
+   * the instance of the object.
+   */
+  QString getInfoString(SIMPL::InfoStringFormat format) override;
+
+  /**
+   * @brief readH5Data
+   * @param parentId
+   * @return
+   */
+  int readH5Data(hid_t parentId) override;
+
+  /**
+   * @brief setValue
+   * @param i
+   * @param value
+   */
+  void setValue(size_t i, bool value)
+  {
+    WordType bit = static_cast<WordType>(1) << (i % k_BitsPerWord);
+    if(value)
+    {
+      m_Words[i / k_BitsPerWord] |= bit;
+    }
+    else
+    {
+      m_Words[i / k_BitsPerWord] &= ~bit;
+    }
+  }
+
+  /**
+   * @brief getValue
+   * @param i
+   * @return
+   */
+  bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+  }
+
+  /**
+   * @brief Packs count bools into the tuples [start, start + count). Calls that write different
+   * words may run concurrently, which is the case when start and count are multiples of 64.
+   * @param start
+   * @param values
+   * @param count
+   */
+  void setValues(size_t start, const bool* values, size_t count);
+
+  /**
+   * @brief Unpacks the tuples [start, start + count) into bools
+   * @param start
+   * @param values
+   * @param count
+   */
+  void getValues(size_t start, bool* values, size_t count) const;
+
+  /**
+   * @brief Returns the number of tuples that are true
+   * @return
+   */
+  size_t countSetBits() const;
+
+  /**
+   * @brief Returns the index of the first true tuple at or after start, or getNumberOfTuples() if there is none
+   * @param start
+   * @return
+   */
+  size_t findNextSetBit(size_t start) const;
+
+  /**
+   * @brief Calls func(index) for every true tuple in ascending order
+   * @param func
+   */
+  template <typename Func> void forEachSetBit(Func func) const
+  {
+    for(size_t i = findNextSetBit(0); i < m_NumTuples; i = findNextSetBit(i + 1))
+    {
+      func(i);
+    }
+  }
+
+  /**
+   * @brief Sets each tuple to its value AND the value in the other mask
+   * @param other A mask with the same number of tuples
+   * @return False if the number of tuples differ
+   */
+  bool bitwiseAnd(const BitMaskArray& other);
+
+  /**
+   * @brief Sets each tuple to its value OR the value in the other mask
+   * @param other A mask with the same number of tuples
+   * @return False if the number of tuples differ
+   */
+  bool bitwiseOr(const BitMaskArray& other);
+
+  /**
+   * @brief Flips every tuple
+   */
+  void invert();
+
+  /**
+   * @brief Returns the number of words that hold the bits
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Returns a pointer to word i of the packed bits
+   * @param i
+   * @return
+   */
+  WordType* getWordPointer(size_t i);
+
+protected:
+  /**
+   * @brief Protected Constructor
+   * @param numTuples The number of tuples in the mask
+   * @param name The name of the mask
+   * @param allocate Whether the words are allocated. They are zero when they are
+   */
+  BitMaskArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  BitMaskArray();
+
+  /**
+   * @brief Clears the unused bits of the last word
+   */
+  void clearTrailingBits();
+
+private:
+  QString m_Name;
+  size_t m_NumTuples;
+  std::vector<WordType> m_Words;
+  bool m_OwnsData;
+
+public:
+  BitMaskArray(const BitMaskArray&) = delete;            // Copy Constructor Not Implemented
+  BitMaskArray(BitMaskArray&&) = delete;                 // Move Constructor Not Implemented
+  BitMaskArray& operator=(const BitMaskArray&) = delete; // Copy Assignment Not Implemented
+  BitMaskArray& operator=(BitMaskArray&&) = delete;      // Move Assignment Not Implemented
+};
@@ -36,21 +36,20 @@
 #pragma once
 
 // STL Includes
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include <cstring>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArrayBulkOps.hpp"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 
 
-#define mxa_bswap(s,d,t)\
-  t[0] = ptr[s];\
-  ptr[s] = ptr[d];\
-  ptr[d] = t[0];
-
 /** @brief Resizes the DataArray Shared m_Array and assigns its internal data pointer
  *
  */
@@ -448,8 +447,8 @@ class DataArray : public IDataArray
       }
 
       size_t elementStart = destTupleOffset*getNumberOfComponents();
-      size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-      std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+      size_t totalElements = totalSrcTuples * sourceArray->getNumberOfComponents();
+      DataArrayBulkOps::Copy<T>(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalElements);
       return true;
     }
 
@@ -461,8 +460,7 @@ class DataArray : public IDataArray
     {
       if(m_IsAllocated == true && dest->isAllocated() && m_Array && dest->getPointer(0))
       {
-        size_t totalBytes = m_Size * sizeof(T);
-        std::memcpy(dest->getPointer(0), m_Array, totalBytes);
+        DataArrayBulkOps::Copy<T>(dest->getPointer(0), m_Array, m_Size);
         return true;
       }
       return false;
@@ -526,6 +524,34 @@ class DataArray : public IDataArray
      */
     bool isAllocated() override { return m_IsAllocated; }
 
+    /**
+     * @brief Selects where the memory for this array comes from the next time it is allocated
+     * or resized. See DataArrayStorage for the details.
+     * @param policy
+     */
+    void setStoragePolicy(DataArrayStorage::Policy policy)
+    {
+      m_StoragePolicy = policy;
+    }
+
+    /**
+     * @brief getStoragePolicy
+     * @return
+     */
+    DataArrayStorage::Policy getStoragePolicy() const
+    {
+      return m_StoragePolicy;
+    }
+
+    /**
+     * @brief Returns true if the values of this array live in a memory mapped scratch file
+     * @return
+     */
+    bool isMemoryMapped() const
+    {
+      return DataArrayStorage::IsMemoryMapped(m_Array);
+    }
+
     /**
      * @brief Gives this array a human readable name
      * @param name The name of this array
@@ -564,10 +590,22 @@ class DataArray : public IDataArray
     /**
      * @brief This class will NOT free the memory associated with the internal pointer.
      * This can be useful if the user wishes to keep the data around after this
-     * class goes out of scope.
+     * class goes out of scope. Whoever takes over the memory releases it with free(), so memory
+     * mapped values are first moved to a heap block. If that copy fails this array keeps ownership.
      */
     void releaseOwnership() override
     {
+      if(m_OwnsData && DataArrayStorage::IsMemoryMapped(m_Array))
+      {
+        size_t numBytes = m_Size * sizeof(T);
+        T* heapArray = static_cast<T*>(DataArrayStorage::Reallocate(m_Array, numBytes, numBytes, DataArrayStorage::Policy::Heap));
+        if(nullptr == heapArray)
+        {
+          qDebug() << "Unable to move the memory mapped array " << m_Name << " to the heap. The array keeps ownership of its memory.";
+          return;
+        }
+        m_Array = heapArray;
+      }
       m_OwnsData = false;
     }
 
@@ -595,7 +633,7 @@ class DataArray : public IDataArray
 #if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
       m_Array = static_cast<T*>( _mm_malloc (newSize * sizeof(T), 16) );
 #else
-      m_Array = (T*)malloc(newSize * sizeof(T));
+      m_Array = static_cast<T*>(DataArrayStorage::Allocate(newSize * sizeof(T), m_StoragePolicy));
 #endif
       if (!m_Array)
       {
@@ -635,8 +673,7 @@ class DataArray : public IDataArray
     void initializeWithZeros() override
     {
       if(!m_IsAllocated || nullptr == m_Array) { return; }
-      size_t typeSize = sizeof(T);
-      ::memset(m_Array, 0, m_Size * typeSize);
+      DataArrayBulkOps::Fill<T>(m_Array, m_Size, static_cast<T>(0));
     }
 
     /**
@@ -644,11 +681,92 @@ class DataArray : public IDataArray
      */
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
-      if(!m_IsAllocated || nullptr == m_Array) { return; }
-      for (size_t i = offset; i < m_Size; i++)
+      if(!m_IsAllocated || nullptr == m_Array || offset >= m_Size) { return; }
+      DataArrayBulkOps::Fill<T>(m_Array + offset, m_Size - offset, initValue);
+    }
+
+    /**
+     * @brief Sets every component of the tuples [tupleOffset, tupleOffset + numTuples) to value
+     * @return false if the tuples are not all inside of the array
+     */
+    bool fillTuples(size_t tupleOffset, size_t numTuples, T value)
+    {
+      if(!m_IsAllocated || nullptr == m_Array || tupleOffset + numTuples > m_NumTuples) { return false; }
+      DataArrayBulkOps::Fill<T>(m_Array + tupleOffset * m_NumComponents, numTuples * m_NumComponents, value);
+      return true;
+    }
+
+    /**
+     * @brief Sets tuple i of this array to tuple indices[i] of source for every i in [0, numIndices).
+     * The arrays must have the same number of components and this array at least numIndices tuples.
+     * @param source
+     * @param indices The source tuple of each destination tuple
+     * @param numIndices
+     * @return false if the arrays do not match or an index is outside of source, in which case the
+     * tuples with an invalid index are left untouched
+     */
+    template <typename IndexType> bool gatherTuples(Self& source, const IndexType* indices, size_t numIndices)
+    {
+      if(!m_IsAllocated || !source.isAllocated() || source.getNumberOfComponents() != getNumberOfComponents() || numIndices > m_NumTuples) { return false; }
+      return DataArrayBulkOps::Gather<T, IndexType>(m_Array, source.getPointer(0), source.getNumberOfTuples(), indices, numIndices, m_NumComponents);
+    }
+
+    /**
+     * @brief Sets tuple indices[i] of this array to tuple i of source for every i in [0, numIndices).
+     * The indices should be unique. The arrays must have the same number of components and source
+     * at least numIndices tuples.
+     * @param source
+     * @param indices The destination tuple of each source tuple
+     * @param numIndices
+     * @return false if the arrays do not match or an index is outside of this array, in which case
+     * the source tuples with an invalid index are skipped
+     */
+    template <typename IndexType> bool scatterTuples(Self& source, const IndexType* indices, size_t numIndices)
+    {
+      if(!m_IsAllocated || !source.isAllocated() || source.getNumberOfComponents() != getNumberOfComponents() || numIndices > source.getNumberOfTuples()) { return false; }
+      return DataArrayBulkOps::Scatter<T, IndexType>(m_Array, m_NumTuples, source.getPointer(0), indices, numIndices, m_NumComponents);
+    }
+
+    /**
+     * @brief Keeps the tuples whose mask value is true, in their current order, and shrinks the
+     * array to hold only those tuples. An array that owns its memory is compacted in place; a
+     * wrapped pointer is left untouched and the kept tuples are copied into a new block.
+     * @param mask One value per tuple
+     * @return The number of tuples that were removed, or -1 if the array is not allocated
+     */
+    int64_t compactTuples(const bool* mask) override
+    {
+      if(!m_IsAllocated || nullptr == m_Array) { return -1; }
+      if(m_OwnsData)
+      {
+        size_t numKept = DataArrayBulkOps::CompactInPlace<T>(m_Array, mask, m_NumTuples, m_NumComponents);
+        size_t numRemoved = m_NumTuples - numKept;
+        if(numRemoved > 0 && resize(numKept) == 0) { return -1; }
+        return static_cast<int64_t>(numRemoved);
+      }
+
+      size_t numKept = static_cast<size_t>(std::count(mask, mask + m_NumTuples, true));
+      size_t numRemoved = m_NumTuples - numKept;
+      if(numRemoved == 0) { return 0; }
+      if(numKept == 0)
       {
-        m_Array[i] = initValue;
+        resize(0);
+        return static_cast<int64_t>(numRemoved);
       }
+
+      size_t newSize = numKept * m_NumComponents;
+      T* newArray = static_cast<T*>(DataArrayStorage::Allocate(newSize * sizeof(T), m_StoragePolicy));
+      if(nullptr == newArray) { return -1; }
+      DataArrayBulkOps::Compact<T>(newArray, m_Array, mask, m_NumTuples, m_NumComponents);
+      _deallocate();
+
+      m_Size = newSize;
+      m_Array = newArray;
+      m_OwnsData = true;
+      m_IsAllocated = true;
+      m_MaxId = newSize - 1;
+      m_NumTuples = numKept;
+      return static_cast<int64_t>(numRemoved);
     }
 
     /**
@@ -683,87 +801,18 @@ class DataArray : public IDataArray
         if (idxs[i] * m_NumComponents > m_MaxId) { return -100; }
       }
 
-      // Calculate the new size of the array to copy into
-      size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
-
-      // Create a new m_Array to copy into
-      T* newArray = (T*)malloc(newSize * sizeof(T));
-      // Splat AB across the array so we know if we are copying the values or not
-      ::memset(newArray, 0xAB, newSize * sizeof(T));
-
-      // Keep the current Destination Pointer
-      T* currentDest = newArray;
-      size_t j = 0;
-      int k = 0;
-      // Find the first chunk to copy by walking the idxs array until we get an
-      // index that is NOT a continuous increment from the start
-      for (k = 0; k < idxs.size(); ++k)
-      {
-        if(j == idxs[k])
-        {
-          ++j;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if(k == idxs.size()) // Only front elements are being dropped
-      {
-        T* currentSrc = m_Array + (j * m_NumComponents);
-        std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
-        m_Size = newSize;
-        m_Array = newArray;
-        m_OwnsData = true;
-        m_MaxId = newSize - 1;
-        m_IsAllocated = true;
-        return 0;
-      }
-
-      QVector<size_t> srcIdx(idxs.size() + 1);
-      QVector<size_t> destIdx(idxs.size() + 1);
-      QVector<size_t> copyElements(idxs.size() + 1);
-      srcIdx[0] = 0;
-      destIdx[0] = 0;
-      copyElements[0] = (idxs[0] - 0) * m_NumComponents;
-
-      for (int i = 1; i < srcIdx.size(); ++i)
+      // Compact the tuples that are not erased into a new block. The indices do not need to be sorted
+      // or unique.
+      std::unique_ptr<bool[]> keep(new bool[getNumberOfTuples()]);
+      DataArrayBulkOps::Fill<bool>(keep.get(), getNumberOfTuples(), true);
+      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
       {
-        srcIdx[i] = (idxs[i - 1] + 1) * m_NumComponents;
-
-        if(i < srcIdx.size() - 1)
-        {
-          copyElements[i] = (idxs[i] - idxs[i - 1] - 1) * m_NumComponents;
-        }
-        else
-        {
-          copyElements[i] = (getNumberOfTuples() - idxs[i - 1] - 1) * m_NumComponents;
-        }
-        destIdx[i] = copyElements[i - 1] + destIdx[i - 1];
+        keep[idxs[i]] = false;
       }
-
-      // Copy the data
-      for (int i = 0; i < srcIdx.size(); ++i)
+      if(compactTuples(keep.get()) < 0)
       {
-        currentDest = newArray + destIdx[i];
-        T* currentSrc = m_Array + srcIdx[i];
-        size_t bytes = copyElements[i] * sizeof(T);
-        std::memcpy(currentDest, currentSrc, bytes);
+        err = -101;
       }
-
-      // We are done copying - delete the current m_Array
-      _deallocate();
-
-      // Allocation was successful.  Save it.
-      m_Size = newSize;
-      m_Array = newArray;
-      // This object has now allocated its memory and owns it.
-      m_OwnsData = true;
-      m_IsAllocated = true;
-      m_MaxId = newSize - 1;
-
       return err;
     }
 
@@ -1106,13 +1155,15 @@ class DataArray : public IDataArray
      */
     IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
     {
-      IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
+      Pointer daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+      daCopy->setStoragePolicy(m_StoragePolicy);
+      if(m_IsAllocated == true)
+      {
+        daCopy->allocate();
+      }
       if(m_IsAllocated == true && forceNoAllocate == false)
       {
-        T* src = getPointer(0);
-        void* dest = daCopy->getVoidPointer(0);
-        size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
-        std::memcpy(dest, src, totalBytes);
+        DataArrayBulkOps::Copy<T>(daCopy->getPointer(0), getPointer(0), getNumberOfTuples() * getNumberOfComponents());
       }
       return daCopy;
     }
@@ -1257,7 +1308,20 @@ class DataArray : public IDataArray
       {
         return -1;
       }
-      m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
+      typename DataArray<T>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(p);
+      if(nullptr != typedArray)
+      {
+        // Take the memory exactly as it is so that a memory mapped block stays memory mapped
+        m_Array = typedArray->m_Array;
+        typedArray->m_OwnsData = false;
+      }
+      else
+      {
+        // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
+        // for deleting the memory
+        p->releaseOwnership();
+        m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
+      }
       m_Size = p->getSize();
       m_OwnsData = true;
       m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
@@ -1266,10 +1330,6 @@ class DataArray : public IDataArray
       m_NumTuples = p->getNumberOfTuples();
       m_CompDims = p->getComponentDimensions();
       m_NumComponents = p->getNumberOfComponents();
-
-      // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
-      // for deleting the memory
-      p->releaseOwnership();
       return err;
     }
 
@@ -1278,29 +1338,8 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
-      char* ptr = (char*)(m_Array);
-      char t[8];
-      size_t size = getTypeSize();
-      for (uint64_t var = 0; var < m_Size; ++var)
-      {
-        if (sizeof(T) == 2)
-        {
-          mxa_bswap(0, 1, t);
-        }
-        else if (sizeof(T) == 4)
-        {
-          mxa_bswap(0, 3, t);
-          mxa_bswap(1, 2, t);
-        }
-        else if (sizeof(T) == 8)
-        {
-          mxa_bswap(0, 7, t);
-          mxa_bswap(1, 6, t);
-          mxa_bswap(2, 5, t);
-          mxa_bswap(3, 4, t);
-        }
-        ptr += size; // increment the pointer
-      }
+      if(nullptr == m_Array) { return; }
+      DataArrayBulkOps::ByteSwap<T>(m_Array, m_Size);
     }
 
     /**
@@ -1341,6 +1380,7 @@ class DataArray : public IDataArray
       m_MaxId = (m_Size > 0) ? m_Size - 1 : m_Size;
 
       m_InitValue = static_cast<T>(0);
+      m_StoragePolicy = DataArrayStorage::Policy::Default;
       //  MUD_FLAP_0 = MUD_FLAP_1 = MUD_FLAP_2 = MUD_FLAP_3 = MUD_FLAP_4 = MUD_FLAP_5 = 0xABABABABABABABABul;
     }
 
@@ -1376,7 +1416,7 @@ class DataArray : public IDataArray
 #if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
       _mm_free( m_buffer );
 #else
-      free(m_Array);
+      DataArrayStorage::Deallocate(m_Array);
 #endif
       m_Array = nullptr;
       m_IsAllocated = false;
@@ -1431,20 +1471,12 @@ class DataArray : public IDataArray
         clear();
         return m_Array;
       }
-      // OS X's realloc does not free memory if the new block is smaller.  This
-      // is a very serious problem and causes huge amount of memory to be
-      // wasted. Do not use realloc on the Mac.
-      bool dontUseRealloc = false;
-#if defined __APPLE__
-      dontUseRealloc = true;
-#endif
-
       // Allocate a new array if we DO NOT own the current array
       if ((nullptr != m_Array) && (false == m_OwnsData))
       {
         // The old array is owned by the user so we cannot try to
         // reallocate it.  Just allocate new memory that we will own.
-        newArray = (T*)malloc(newSize * sizeof(T));
+        newArray = static_cast<T*>(DataArrayStorage::Allocate(newSize * sizeof(T), m_StoragePolicy));
         if (!newArray)
         {
           qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -1454,32 +1486,15 @@ class DataArray : public IDataArray
         // Copy the data from the old array.
         std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
       }
-      else if (!dontUseRealloc)
-      {
-        // Try to reallocate with minimal memory usage and possibly avoid copying.
-        newArray = (T*)realloc(m_Array, newSize * sizeof(T));
-        if (!newArray)
-        {
-          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
-          return nullptr;
-        }
-      }
       else
       {
-        newArray = (T*)malloc(newSize * sizeof(T));
+        // Try to reallocate with minimal memory usage and possibly avoid copying.
+        newArray = static_cast<T*>(DataArrayStorage::Reallocate(m_Array, m_Size * sizeof(T), newSize * sizeof(T), m_StoragePolicy));
         if (!newArray)
         {
           qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
           return nullptr;
         }
-
-        // Copy the data from the old array.
-        if (m_Array != nullptr)
-        {
-          std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
-        }
-        // Free the old array
-        _deallocate();
       }
 
       // Allocation was successful.  Save it.
@@ -1525,6 +1540,8 @@ class DataArray : public IDataArray
 
     T m_InitValue;
 
+    DataArrayStorage::Policy m_StoragePolicy;
+
     DataArray(const DataArray&); //Not Implemented
     void operator=(const DataArray&); //Not Implemented
 
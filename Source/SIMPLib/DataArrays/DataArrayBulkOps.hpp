@@ -0,0 +1,622 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The DataArrayBulkOps namespace holds the bulk kernels behind DataArray<T>: fill, copy,
+ * byte swap, gather, scatter and compact. Each kernel is split into blocks of at least k_Grain
+ * elements that run in parallel through ExecutionContext. Smaller inputs stay on the calling thread.
+ * The inner loops are plain contiguous loops (std::fill_n, memcpy, shift based byte swaps) so that the
+ * compiler can vectorize them.
+ */
+namespace DataArrayBulkOps
+{
+/**
+ * @brief The number of elements below which a kernel does not split its work
+ */
+static const size_t k_Grain = 32768;
+
+/**
+ * @brief Runs impl.compute() over [0, numItems), in parallel blocks of at least grain items when
+ * the parallel algorithms are available
+ * @param impl
+ * @param numItems
+ * @param grain
+ */
+template <typename Impl> void Run(const Impl& impl, size_t numItems, size_t grain)
+{
+  if(numItems == 0)
+  {
+    return;
+  }
+  grain = std::max(grain, static_cast<size_t>(1));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(numItems > grain && ExecutionContext::IsParallel())
+  {
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, numItems, grain), impl, tbb::auto_partitioner()); });
+    return;
+  }
+#endif
+  impl.compute(0, numItems);
+}
+
+/**
+ * @brief Returns the number of tuples in a block of k_Grain elements
+ * @param numComp
+ * @return
+ */
+inline size_t TupleGrain(size_t numComp)
+{
+  return std::max(k_Grain / std::max(numComp, static_cast<size_t>(1)), static_cast<size_t>(1));
+}
+
+namespace Detail
+{
+/**
+ * @brief Copies one value of Size bytes with its bytes reversed. dest may equal src.
+ */
+template <size_t Size> struct SwapValue
+{
+  static void Copy(uint8_t* dest, const uint8_t* src)
+  {
+    uint8_t value[Size];
+    for(size_t k = 0; k < Size; k++)
+    {
+      value[k] = src[Size - 1 - k];
+    }
+    std::memcpy(dest, value, Size);
+  }
+};
+
+/**
+ * @brief Swaps through an unsigned integer so the shift based reverse can be vectorized
+ */
+template <typename UIntType> struct SwapUIntValue
+{
+  static void Copy(uint8_t* dest, const uint8_t* src)
+  {
+    UIntType value;
+    std::memcpy(&value, src, sizeof(UIntType));
+    SIMPLib::Endian::reverseBytes(value);
+    std::memcpy(dest, &value, sizeof(UIntType));
+  }
+};
+
+template <> struct SwapValue<2> : public SwapUIntValue<uint16_t>
+{
+};
+template <> struct SwapValue<4> : public SwapUIntValue<uint32_t>
+{
+};
+template <> struct SwapValue<8> : public SwapUIntValue<uint64_t>
+{
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename IndexType> inline typename std::enable_if<std::is_signed<IndexType>::value, bool>::type IsNegative(IndexType value)
+{
+  return value < 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename IndexType> inline typename std::enable_if<!std::is_signed<IndexType>::value, bool>::type IsNegative(IndexType)
+{
+  return false;
+}
+} // namespace Detail
+
+/**
+ * @brief The FillImpl class sets a range of elements to one value
+ */
+template <typename T> class FillImpl
+{
+public:
+  FillImpl(T* destination, T value)
+  : m_Destination(destination)
+  , m_Value(value)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    std::fill_n(m_Destination + start, end - start, m_Value);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Destination;
+  T m_Value;
+};
+
+/**
+ * @brief The CopyImpl class copies elements between two memory blocks that do not overlap. The
+ * source does not need to be aligned for T.
+ */
+template <typename T> class CopyImpl
+{
+public:
+  CopyImpl(T* destination, const void* source)
+  : m_Destination(destination)
+  , m_Source(static_cast<const uint8_t*>(source))
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    std::memcpy(m_Destination + start, m_Source + start * sizeof(T), (end - start) * sizeof(T));
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Destination;
+  const uint8_t* m_Source;
+};
+
+/**
+ * @brief The ByteSwapCopyImpl class reverses the bytes of every value while copying it. Each
+ * value is loaded and stored with memcpy, so the source may be unaligned and may be the
+ * destination itself.
+ */
+template <typename T> class ByteSwapCopyImpl
+{
+public:
+  ByteSwapCopyImpl(T* destination, const void* source)
+  : m_Destination(reinterpret_cast<uint8_t*>(destination))
+  , m_Source(static_cast<const uint8_t*>(source))
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      Detail::SwapValue<sizeof(T)>::Copy(m_Destination + i * sizeof(T), m_Source + i * sizeof(T));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  uint8_t* m_Destination;
+  const uint8_t* m_Source;
+};
+
+/**
+ * @brief The GatherImpl class copies tuple indices[i] of the source to tuple i of the destination.
+ * Indices outside of the source are skipped and reported through the invalid flag.
+ */
+template <typename T, typename IndexType> class GatherImpl
+{
+public:
+  GatherImpl(T* destination, const T* source, size_t numSourceTuples, const IndexType* indices, size_t numComp, std::atomic<bool>& invalid)
+  : m_Destination(destination)
+  , m_Source(source)
+  , m_NumSourceTuples(numSourceTuples)
+  , m_Indices(indices)
+  , m_NumComp(numComp)
+  , m_Invalid(invalid)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    bool invalid = false;
+    for(size_t i = start; i < end; i++)
+    {
+      size_t index = static_cast<size_t>(m_Indices[i]);
+      if(Detail::IsNegative(m_Indices[i]) || index >= m_NumSourceTuples)
+      {
+        invalid = true;
+        continue;
+      }
+      const T* src = m_Source + index * m_NumComp;
+      T* dest = m_Destination + i * m_NumComp;
+      if(m_NumComp == 1)
+      {
+        *dest = *src;
+      }
+      else
+      {
+        std::copy(src, src + m_NumComp, dest);
+      }
+    }
+    if(invalid)
+    {
+      m_Invalid = true;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Destination;
+  const T* m_Source;
+  size_t m_NumSourceTuples;
+  const IndexType* m_Indices;
+  size_t m_NumComp;
+  std::atomic<bool>& m_Invalid;
+};
+
+/**
+ * @brief The ScatterImpl class copies tuple i of the source to tuple indices[i] of the destination.
+ * Indices outside of the destination are skipped and reported through the invalid flag.
+ */
+template <typename T, typename IndexType> class ScatterImpl
+{
+public:
+  ScatterImpl(T* destination, size_t numDestinationTuples, const T* source, const IndexType* indices, size_t numComp, std::atomic<bool>& invalid)
+  : m_Destination(destination)
+  , m_NumDestinationTuples(numDestinationTuples)
+  , m_Source(source)
+  , m_Indices(indices)
+  , m_NumComp(numComp)
+  , m_Invalid(invalid)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    bool invalid = false;
+    for(size_t i = start; i < end; i++)
+    {
+      size_t index = static_cast<size_t>(m_Indices[i]);
+      if(Detail::IsNegative(m_Indices[i]) || index >= m_NumDestinationTuples)
+      {
+        invalid = true;
+        continue;
+      }
+      const T* src = m_Source + i * m_NumComp;
+      T* dest = m_Destination + index * m_NumComp;
+      if(m_NumComp == 1)
+      {
+        *dest = *src;
+      }
+      else
+      {
+        std::copy(src, src + m_NumComp, dest);
+      }
+    }
+    if(invalid)
+    {
+      m_Invalid = true;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Destination;
+  size_t m_NumDestinationTuples;
+  const T* m_Source;
+  const IndexType* m_Indices;
+  size_t m_NumComp;
+  std::atomic<bool>& m_Invalid;
+};
+
+/**
+ * @brief The CompactImpl class works on fixed size blocks of tuples. The counting pass stores the
+ * number of kept tuples of each block; once those are turned into output offsets the copy pass
+ * copies every run of consecutive kept tuples of a block with one memcpy.
+ */
+template <typename T> class CompactImpl
+{
+public:
+  CompactImpl(T* destination, const T* source, const bool* keep, size_t numTuples, size_t numComp, size_t blockSize, std::vector<size_t>& blockCounts, bool countPass)
+  : m_Destination(destination)
+  , m_Source(source)
+  , m_Keep(keep)
+  , m_NumTuples(numTuples)
+  , m_NumComp(numComp)
+  , m_BlockSize(blockSize)
+  , m_BlockCounts(blockCounts)
+  , m_CountPass(countPass)
+  {
+  }
+
+  void compute(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t b = startBlock; b < endBlock; b++)
+    {
+      size_t first = b * m_BlockSize;
+      size_t last = std::min(first + m_BlockSize, m_NumTuples);
+      if(m_CountPass)
+      {
+        m_BlockCounts[b] = static_cast<size_t>(std::count(m_Keep + first, m_Keep + last, true));
+        continue;
+      }
+      size_t destTuple = m_BlockCounts[b];
+      size_t t = first;
+      while(t < last)
+      {
+        if(!m_Keep[t])
+        {
+          t++;
+          continue;
+        }
+        size_t runStart = t;
+        while(t < last && m_Keep[t])
+        {
+          t++;
+        }
+        std::memcpy(m_Destination + destTuple * m_NumComp, m_Source + runStart * m_NumComp, (t - runStart) * m_NumComp * sizeof(T));
+        destTuple += t - runStart;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Destination;
+  const T* m_Source;
+  const bool* m_Keep;
+  size_t m_NumTuples;
+  size_t m_NumComp;
+  size_t m_BlockSize;
+  std::vector<size_t>& m_BlockCounts;
+  bool m_CountPass;
+};
+
+/**
+ * @brief The CompactInPlaceImpl class moves the kept tuples of every block to the front of that
+ * same block and stores how many tuples each block kept. Blocks never touch each other's values.
+ */
+template <typename T> class CompactInPlaceImpl
+{
+public:
+  CompactInPlaceImpl(T* values, const bool* keep, size_t numTuples, size_t numComp, size_t blockSize, std::vector<size_t>& blockCounts)
+  : m_Values(values)
+  , m_Keep(keep)
+  , m_NumTuples(numTuples)
+  , m_NumComp(numComp)
+  , m_BlockSize(blockSize)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+
+  void compute(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t b = startBlock; b < endBlock; b++)
+    {
+      size_t first = b * m_BlockSize;
+      size_t last = std::min(first + m_BlockSize, m_NumTuples);
+      size_t destTuple = first;
+      size_t t = first;
+      while(t < last)
+      {
+        if(!m_Keep[t])
+        {
+          t++;
+          continue;
+        }
+        size_t runStart = t;
+        while(t < last && m_Keep[t])
+        {
+          t++;
+        }
+        if(runStart != destTuple)
+        {
+          std::memmove(m_Values + destTuple * m_NumComp, m_Values + runStart * m_NumComp, (t - runStart) * m_NumComp * sizeof(T));
+        }
+        destTuple += t - runStart;
+      }
+      m_BlockCounts[b] = destTuple - first;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Values;
+  const bool* m_Keep;
+  size_t m_NumTuples;
+  size_t m_NumComp;
+  size_t m_BlockSize;
+  std::vector<size_t>& m_BlockCounts;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void Fill(T* destination, size_t numValues, T value)
+{
+  Run(FillImpl<T>(destination, value), numValues, k_Grain);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void Copy(T* destination, const void* source, size_t numValues)
+{
+  Run(CopyImpl<T>(destination, source), numValues, k_Grain);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void ByteSwapCopy(T* destination, const void* source, size_t numValues)
+{
+  if(sizeof(T) == 1)
+  {
+    if(static_cast<const void*>(destination) != source)
+    {
+      Copy<T>(destination, source, numValues);
+    }
+    return;
+  }
+  Run(ByteSwapCopyImpl<T>(destination, source), numValues, k_Grain);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void ByteSwap(T* values, size_t numValues)
+{
+  ByteSwapCopy<T>(values, values, numValues);
+}
+
+/**
+ * @brief Copies tuple indices[i] of source to tuple i of destination for every i in [0, numIndices)
+ * @return false if any index was outside of [0, numSourceTuples); those tuples are left untouched
+ */
+template <typename T, typename IndexType> bool Gather(T* destination, const T* source, size_t numSourceTuples, const IndexType* indices, size_t numIndices, size_t numComp)
+{
+  std::atomic<bool> invalid(false);
+  Run(GatherImpl<T, IndexType>(destination, source, numSourceTuples, indices, numComp, invalid), numIndices, TupleGrain(numComp));
+  return !invalid;
+}
+
+/**
+ * @brief Copies tuple i of source to tuple indices[i] of destination for every i in [0, numIndices).
+ * The indices should be unique, otherwise which source tuple ends up in a shared destination is not defined.
+ * @return false if any index was outside of [0, numDestinationTuples); those tuples are skipped
+ */
+template <typename T, typename IndexType> bool Scatter(T* destination, size_t numDestinationTuples, const T* source, const IndexType* indices, size_t numIndices, size_t numComp)
+{
+  std::atomic<bool> invalid(false);
+  Run(ScatterImpl<T, IndexType>(destination, numDestinationTuples, source, indices, numComp, invalid), numIndices, TupleGrain(numComp));
+  return !invalid;
+}
+
+/**
+ * @brief Copies the tuples of source whose keep flag is true, in order, to the front of destination.
+ * The two blocks must not overlap.
+ * @return The number of tuples copied
+ */
+template <typename T> size_t Compact(T* destination, const T* source, const bool* keep, size_t numTuples, size_t numComp)
+{
+  size_t blockSize = TupleGrain(numComp);
+  size_t numBlocks = (numTuples + blockSize - 1) / blockSize;
+  std::vector<size_t> blockCounts(numBlocks, 0);
+  Run(CompactImpl<T>(destination, source, keep, numTuples, numComp, blockSize, blockCounts, true), numBlocks, 1);
+
+  size_t total = 0;
+  for(size_t b = 0; b < numBlocks; b++)
+  {
+    size_t count = blockCounts[b];
+    blockCounts[b] = total;
+    total += count;
+  }
+
+  Run(CompactImpl<T>(destination, source, keep, numTuples, numComp, blockSize, blockCounts, false), numBlocks, 1);
+  return total;
+}
+
+/**
+ * @brief Moves the tuples whose keep flag is true, in order, to the front of values without
+ * allocating a second block.
+ * @return The number of tuples kept
+ */
+template <typename T> size_t CompactInPlace(T* values, const bool* keep, size_t numTuples, size_t numComp)
+{
+  size_t blockSize = TupleGrain(numComp);
+  size_t numBlocks = (numTuples + blockSize - 1) / blockSize;
+  std::vector<size_t> blockCounts(numBlocks, 0);
+  Run(CompactInPlaceImpl<T>(values, keep, numTuples, numComp, blockSize, blockCounts), numBlocks, 1);
+
+  // Slide every block's kept tuples down behind those of the previous blocks. Each block only moves
+  // towards the front and the blocks are visited in order, so nothing is overwritten before it moved.
+  size_t total = 0;
+  for(size_t b = 0; b < numBlocks; b++)
+  {
+    size_t first = b * blockSize;
+    if(total != first && blockCounts[b] > 0)
+    {
+      std::memmove(values + total * numComp, values + first * numComp, blockCounts[b] * numComp * sizeof(T));
+    }
+    total += blockCounts[b];
+  }
+  return total;
+}
+} // namespace DataArrayBulkOps
@@ -0,0 +1,354 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayStorage.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QTemporaryFile>
+
+namespace
+{
+/**
+ * @brief Book keeping for the memory mapped blocks. Each block is backed by its own file: either
+ * a scratch file, which is removed when the block is deallocated, or an input file from MapFile().
+ */
+class MappedBlocks
+{
+public:
+  MappedBlocks()
+  {
+    bool ok = false;
+    qulonglong thresholdMB = qgetenv("SIMPL_MEMORY_MAP_THRESHOLD_MB").toULongLong(&ok);
+    if(ok)
+    {
+      m_Threshold = static_cast<size_t>(thresholdMB) * 1024 * 1024;
+    }
+    QByteArray directory = qgetenv("SIMPL_MEMORY_MAP_DIRECTORY");
+    m_Directory = directory.isEmpty() ? QDir::tempPath() : QString::fromLocal8Bit(directory);
+  }
+
+  ~MappedBlocks()
+  {
+    for(QHash<void*, QFile*>::iterator iter = m_Files.begin(); iter != m_Files.end(); ++iter)
+    {
+      delete iter.value();
+    }
+  }
+
+  QMutex m_Mutex;
+  QHash<void*, QFile*> m_Files;
+  std::atomic<size_t> m_Count{0};
+  std::atomic<size_t> m_Threshold{0};
+  QString m_Directory;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedBlocks& GetMappedBlocks()
+{
+  static MappedBlocks blocks;
+  return blocks;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MapScratchFile(size_t numBytes)
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  QString directory = DataArrayStorage::GetScratchDirectory();
+  QTemporaryFile* file = new QTemporaryFile(QDir(directory).filePath("SIMPL_DataArray_XXXXXX.scratch"));
+  if(!file->open() || !file->resize(static_cast<qint64>(numBytes)))
+  {
+    qDebug() << "Unable to create a scratch file of " << numBytes << " bytes in " << directory;
+    delete file;
+    return nullptr;
+  }
+  uchar* ptr = file->map(0, static_cast<qint64>(numBytes));
+  if(nullptr == ptr)
+  {
+    qDebug() << "Unable to memory map the scratch file " << file->fileName();
+    delete file;
+    return nullptr;
+  }
+
+  QMutexLocker locker(&blocks.m_Mutex);
+  blocks.m_Files.insert(ptr, file);
+  blocks.m_Count++;
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QFile* TakeMappedFile(void* ptr)
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  if(nullptr == ptr || blocks.m_Count == 0)
+  {
+    return nullptr;
+  }
+  QMutexLocker locker(&blocks.m_Mutex);
+  QFile* file = blocks.m_Files.take(ptr);
+  if(nullptr != file)
+  {
+    blocks.m_Count--;
+  }
+  return file;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void InsertMappedFile(void* ptr, QFile* file)
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  QMutexLocker locker(&blocks.m_Mutex);
+  blocks.m_Files.insert(ptr, file);
+  blocks.m_Count++;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayStorage::DataArrayStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayStorage::~DataArrayStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::UseMemoryMap(size_t numBytes, Policy policy)
+{
+  switch(policy)
+  {
+  case Policy::Heap:
+    return false;
+  case Policy::MemoryMapped:
+    return numBytes > 0;
+  case Policy::Default:
+    break;
+  }
+  size_t threshold = GetMemoryMapThreshold();
+  return threshold > 0 && numBytes >= threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::Allocate(size_t numBytes, Policy policy)
+{
+  if(UseMemoryMap(numBytes, policy))
+  {
+    void* ptr = MapScratchFile(numBytes);
+    if(nullptr != ptr)
+    {
+      return ptr;
+    }
+  }
+  return malloc(numBytes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::Reallocate(void* ptr, size_t oldBytes, size_t newBytes, Policy policy)
+{
+  bool mapNew = UseMemoryMap(newBytes, policy);
+  if(nullptr == ptr)
+  {
+    return Allocate(newBytes, policy);
+  }
+
+  QFile* file = TakeMappedFile(ptr);
+  if(nullptr != file && mapNew && nullptr != qobject_cast<QTemporaryFile*>(file))
+  {
+    // Resize the scratch file and map it again. The contents stay in the file so nothing is copied.
+    file->unmap(static_cast<uchar*>(ptr));
+    void* newPtr = nullptr;
+    if(file->resize(static_cast<qint64>(newBytes)))
+    {
+      newPtr = file->map(0, static_cast<qint64>(newBytes));
+    }
+    if(nullptr == newPtr)
+    {
+      // Put the original block back so the caller still owns valid memory
+      file->resize(static_cast<qint64>(oldBytes));
+      newPtr = file->map(0, static_cast<qint64>(oldBytes));
+      if(nullptr != newPtr)
+      {
+        InsertMappedFile(newPtr, file);
+      }
+      else
+      {
+        delete file;
+      }
+      qDebug() << "Unable to remap the scratch file to " << newBytes << " bytes";
+      return nullptr;
+    }
+    InsertMappedFile(newPtr, file);
+    return newPtr;
+  }
+  if(nullptr != file)
+  {
+    // The block was memory mapped but will not be anymore, or it maps an input file that must not be resized
+    InsertMappedFile(ptr, file);
+  }
+  else if(!mapNew)
+  {
+// OS X's realloc does not free memory if the new block is smaller.  This
+// is a very serious problem and causes huge amount of memory to be
+// wasted. Do not use realloc on the Mac.
+#if !defined __APPLE__
+    return realloc(ptr, newBytes);
+#endif
+  }
+
+  void* newPtr = Allocate(newBytes, policy);
+  if(nullptr == newPtr)
+  {
+    return nullptr;
+  }
+  std::memcpy(newPtr, ptr, (newBytes < oldBytes ? newBytes : oldBytes));
+  Deallocate(ptr);
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayStorage::MapFile(const QString& filePath, qint64 offset, size_t numBytes)
+{
+  if(numBytes == 0 || offset < 0)
+  {
+    return nullptr;
+  }
+  QFile* file = new QFile(filePath);
+  if(!file->open(QIODevice::ReadOnly) || file->size() - offset < static_cast<qint64>(numBytes))
+  {
+    qDebug() << "Unable to open " << numBytes << " bytes at offset " << offset << " of " << filePath;
+    delete file;
+    return nullptr;
+  }
+  // A private mapping is writable without ever writing back to the file
+  uchar* ptr = file->map(offset, static_cast<qint64>(numBytes), QFileDevice::MapPrivateOption);
+  if(nullptr == ptr)
+  {
+    qDebug() << "Unable to memory map the file " << filePath;
+    delete file;
+    return nullptr;
+  }
+  InsertMappedFile(ptr, file);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::Deallocate(void* ptr)
+{
+  QFile* file = TakeMappedFile(ptr);
+  if(nullptr != file)
+  {
+    file->unmap(static_cast<uchar*>(ptr));
+    delete file; // Closes the file and removes it if it is a scratch file
+    return;
+  }
+  free(ptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayStorage::IsMemoryMapped(const void* ptr)
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  if(nullptr == ptr || blocks.m_Count == 0)
+  {
+    return false;
+  }
+  QMutexLocker locker(&blocks.m_Mutex);
+  return blocks.m_Files.contains(const_cast<void*>(ptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetMemoryMapThreshold(size_t numBytes)
+{
+  GetMappedBlocks().m_Threshold = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayStorage::GetMemoryMapThreshold()
+{
+  return GetMappedBlocks().m_Threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayStorage::SetScratchDirectory(const QString& path)
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  QMutexLocker locker(&blocks.m_Mutex);
+  blocks.m_Directory = path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayStorage::GetScratchDirectory()
+{
+  MappedBlocks& blocks = GetMappedBlocks();
+  QMutexLocker locker(&blocks.m_Mutex);
+  return blocks.m_Directory;
+}
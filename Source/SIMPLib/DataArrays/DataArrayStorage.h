@@ -0,0 +1,159 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataArrayStorage class allocates the raw memory that backs DataArray<T>. Memory
+ * either comes from the heap or from a memory mapped scratch file, which lets an array be larger
+ * than the physical memory of the machine: the operating system pages the data in and out of the
+ * scratch file as it is touched. Either way the DataArray keeps a plain pointer to its values, so
+ * code that uses getPointer() or getVoidPointer() does not need to know where the memory lives.
+ *
+ * Memory mapping is selected per array through DataArray<T>::setStoragePolicy() or, for arrays
+ * left at the Default policy, for every allocation at or above the memory map threshold. The
+ * threshold is 0 (disabled) unless the SIMPL_MEMORY_MAP_THRESHOLD_MB environment variable is set.
+ * Scratch files are created in the system temporary directory unless the
+ * SIMPL_MEMORY_MAP_DIRECTORY environment variable names another one.
+ *
+ * MapFile() maps part of an existing file instead of a scratch file so that a reader can hand the
+ * file itself to a DataArray without reading it into memory first.
+ */
+class SIMPLib_EXPORT DataArrayStorage
+{
+  public:
+    enum class Policy : unsigned int
+    {
+      Default = 0,  //!< Memory map allocations at or above the threshold
+      Heap = 1,     //!< Always allocate from the heap
+      MemoryMapped = 2 //!< Always allocate from a memory mapped scratch file
+    };
+
+    virtual ~DataArrayStorage();
+
+    /**
+     * @brief Allocates numBytes of memory according to the policy. If a scratch file can not be
+     * mapped the memory comes from the heap instead.
+     * @param numBytes
+     * @param policy
+     * @return The memory, or nullptr if it could not be allocated
+     */
+    static void* Allocate(size_t numBytes, Policy policy = Policy::Default);
+
+    /**
+     * @brief Resizes memory that came from Allocate() and keeps the leading min(oldBytes, newBytes)
+     * bytes. A memory mapped block that stays memory mapped is remapped without copying.
+     * @param ptr The current memory, may be nullptr
+     * @param oldBytes The current size of ptr
+     * @param newBytes The requested size
+     * @param policy
+     * @return The new memory, or nullptr on failure in which case ptr is left untouched
+     */
+    static void* Reallocate(void* ptr, size_t oldBytes, size_t newBytes, Policy policy = Policy::Default);
+
+    /**
+     * @brief Maps numBytes of an existing file, starting at offset, as copy on write memory. The
+     * values are paged in from the file as they are touched and writes go to private copies of the
+     * pages, so the file itself is never modified. The memory is released with Deallocate() and
+     * moved to a new block (the file is never resized) by Reallocate().
+     * @param filePath
+     * @param offset The byte offset of the first mapped byte, which does not need to be page aligned
+     * @param numBytes
+     * @return The memory, or nullptr if the file could not be mapped
+     */
+    static void* MapFile(const QString& filePath, qint64 offset, size_t numBytes);
+
+    /**
+     * @brief Releases memory that came from Allocate(), Reallocate() or MapFile(), unmapping and
+     * removing the scratch file if there is one.
+     * @param ptr
+     */
+    static void Deallocate(void* ptr);
+
+    /**
+     * @brief Returns true if ptr is the start of a memory mapped block
+     * @param ptr
+     * @return
+     */
+    static bool IsMemoryMapped(const void* ptr);
+
+    /**
+     * @brief Returns true if an allocation of numBytes with the given policy is memory mapped
+     * @param numBytes
+     * @param policy
+     * @return
+     */
+    static bool UseMemoryMap(size_t numBytes, Policy policy);
+
+    /**
+     * @brief Sets the size in bytes at or above which Default policy allocations are memory
+     * mapped. Zero turns threshold based memory mapping off.
+     * @param numBytes
+     */
+    static void SetMemoryMapThreshold(size_t numBytes);
+
+    /**
+     * @brief GetMemoryMapThreshold
+     * @return
+     */
+    static size_t GetMemoryMapThreshold();
+
+    /**
+     * @brief Sets the directory that new scratch files are created in
+     * @param path
+     */
+    static void SetScratchDirectory(const QString& path);
+
+    /**
+     * @brief GetScratchDirectory
+     * @return
+     */
+    static QString GetScratchDirectory();
+
+  protected:
+    DataArrayStorage();
+
+  public:
+    DataArrayStorage(const DataArrayStorage&) = delete; // Copy Constructor Not Implemented
+    DataArrayStorage(DataArrayStorage&&) = delete;      // Move Constructor Not Implemented
+    DataArrayStorage& operator=(const DataArrayStorage&) = delete; // Copy Assignment Not Implemented
+    DataArrayStorage& operator=(DataArrayStorage&&) = delete;      // Move Assignment Not Implemented
+};
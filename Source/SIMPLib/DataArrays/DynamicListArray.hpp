@@ -64,19 +64,7 @@ public:
   // -----------------------------------------------------------------------------
   virtual ~DynamicListArray()
   {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
+    deallocate();
   }
 
   /**
@@ -88,6 +76,16 @@ public:
     return m_Size;
   }
 
+  /**
+   * @brief isCompressed Returns true if all of the lists are stored in a single contiguous
+   * block of memory (compressed sparse row layout).
+   * @return
+   */
+  bool isCompressed()
+  {
+    return m_Storage != nullptr;
+  }
+
   /**
    * @brief deepCopy
    * @param forceNoAllocate
@@ -109,7 +107,14 @@ public:
       linkCounts[ptId] = this->m_Array[ptId].ncells;
     }
     // Allocate all that in the copy
-    copy->allocateLists(linkCounts);
+    if(isCompressed())
+    {
+      copy->allocateCompressedLists(linkCounts);
+    }
+    else
+    {
+      copy->allocateLists(linkCounts);
+    }
     // Copy the data from the original to the new
     for(size_t ptId = 0; ptId < m_Size; ptId++)
     {
@@ -153,6 +158,12 @@ public:
     {
       return false;
     }
+    if(isCompressed() && m_Array[ptId].ncells == nCells)
+    {
+      ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+      return true;
+    }
+    uncompress();
     if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
     {
       m_Array[ptId].cells = nullptr;
@@ -179,6 +190,12 @@ public:
     {
       return false;
     }
+    if(isCompressed() && m_Array[ptId].ncells == nCells)
+    {
+      ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+      return true;
+    }
+    uncompress();
     if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
     {
       m_Array[ptId].cells = nullptr;
@@ -288,33 +305,99 @@ public:
     }
   }
 
+  /**
+   * @brief allocateCompressedLists Allocates the lists in compressed sparse row layout: one
+   * contiguous block holds every list back to back so only two allocations are made no matter
+   * how many lists there are. The list for ptId starts at the sum of the counts of all previous lists.
+   * @param linkCounts
+   */
+  template <typename Container> void allocateCompressedLists(const Container& linkCounts)
+  {
+    allocate(linkCounts.size());
+    size_t total = 0;
+    for(typename Container::size_type i = 0; i < linkCounts.size(); i++)
+    {
+      total += linkCounts[i];
+    }
+    // Always allocate at least one entry so that isCompressed() holds for empty lists
+    this->m_Storage = new K[total > 0 ? total : 1];
+    size_t offset = 0;
+    for(typename Container::size_type i = 0; i < linkCounts.size(); i++)
+    {
+      this->m_Array[i].ncells = linkCounts[i];
+      this->m_Array[i].cells = this->m_Storage + offset;
+      offset += linkCounts[i];
+    }
+  }
+
 protected:
   DynamicListArray()
   : m_Array(nullptr)
   , m_Size(0)
+  , m_Storage(nullptr)
   {
   }
 
   //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
-  // structure is initialized to Zero Entries and a nullptr Pointer
-  void allocate(size_t sz, size_t ext = 1000)
+  // Frees every list and the NeighborList structures themselves
+  void deallocate()
   {
-    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
-
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
+    if(nullptr != this->m_Storage)
+    {
+      delete[] this->m_Storage;
+      this->m_Storage = nullptr;
+    }
+    else
     {
-      if(this->m_Array[i].cells != nullptr)
+      // This makes sure we deallocate any lists that have been created
+      for(size_t i = 0; i < this->m_Size; i++)
       {
-        delete[] this->m_Array[i].cells;
+        if(this->m_Array[i].cells != nullptr)
+        {
+          delete[] this->m_Array[i].cells;
+        }
       }
     }
     // Now delete all the "NeighborLists" structures
     if(this->m_Array != nullptr)
     {
       delete[] this->m_Array;
+      this->m_Array = nullptr;
     }
+    this->m_Size = 0;
+  }
+
+  //----------------------------------------------------------------------------
+  // Converts compressed lists back into one allocation per list so that a list
+  // can be replaced by one of a different length
+  void uncompress()
+  {
+    if(nullptr == this->m_Storage)
+    {
+      return;
+    }
+    for(size_t i = 0; i < this->m_Size; i++)
+    {
+      K* cells = nullptr;
+      if(this->m_Array[i].ncells > 0)
+      {
+        cells = new K[this->m_Array[i].ncells];
+        ::memcpy(cells, this->m_Array[i].cells, sizeof(K) * this->m_Array[i].ncells);
+      }
+      this->m_Array[i].cells = cells;
+    }
+    delete[] this->m_Storage;
+    this->m_Storage = nullptr;
+  }
+
+  //----------------------------------------------------------------------------
+  // This will allocate memory to hold all the NeighborList structures where each
+  // structure is initialized to Zero Entries and a nullptr Pointer
+  void allocate(size_t sz, size_t ext = 1000)
+  {
+    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
+
+    deallocate();
 
     this->m_Size = sz;
     // Allocate a whole new set of structures
@@ -330,6 +413,7 @@ protected:
 private:
   ElementList* m_Array; // pointer to data
   size_t m_Size;
+  K* m_Storage; // contiguous storage for all lists when compressed
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
@@ -0,0 +1,209 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class FeatureDataView FeatureDataView.hpp SIMPLib/DataArrays/FeatureDataView.hpp
+ * @brief Presents a Feature level DataArray<T> as if it were an Element level array. Element i
+ * of the view is tuple featureIds[i] of the Feature array, so reading the view never allocates an
+ * Element sized copy of the data. Code that only needs to look at the values (rendering, statistics,
+ * writers that stream in chunks) can use the view directly and gather() just the elements that it needs.
+ *
+ * The view does not check the Feature Ids: every id must lie in [0, number of Features). The view
+ * keeps both arrays alive for as long as it exists.
+ */
+template <typename T> class FeatureDataView
+{
+public:
+  using FeatureArrayType = DataArray<T>;
+
+  /**
+   * @brief FeatureDataView
+   * @param featureData The Feature level array
+   * @param featureIds The single component Feature Ids of each element
+   */
+  FeatureDataView(typename FeatureArrayType::Pointer featureData, Int32ArrayType::Pointer featureIds)
+  : m_FeatureData(featureData)
+  , m_FeatureIds(featureIds)
+  {
+  }
+
+  FeatureDataView(const FeatureDataView&) = default;
+  FeatureDataView(FeatureDataView&&) = default;
+  FeatureDataView& operator=(const FeatureDataView&) = default;
+  FeatureDataView& operator=(FeatureDataView&&) = default;
+  ~FeatureDataView() = default;
+
+  /**
+   * @brief Returns true if both arrays are set and the Feature Ids have a single component
+   * @return
+   */
+  bool isValid() const
+  {
+    return nullptr != m_FeatureData.get() && nullptr != m_FeatureIds.get() && m_FeatureIds->getNumberOfComponents() == 1;
+  }
+
+  /**
+   * @brief Returns the number of elements in the view
+   * @return
+   */
+  size_t getNumberOfTuples() const
+  {
+    return m_FeatureIds->getNumberOfTuples();
+  }
+
+  /**
+   * @brief Returns the number of components of the Feature array
+   * @return
+   */
+  int getNumberOfComponents() const
+  {
+    return m_FeatureData->getNumberOfComponents();
+  }
+
+  /**
+   * @brief Returns a pointer to the first component of element i. The pointer points into the
+   * Feature array, so elements that belong to the same Feature share it.
+   * @param i
+   * @return
+   */
+  const T* getTuplePointer(size_t i) const
+  {
+    size_t numComp = static_cast<size_t>(m_FeatureData->getNumberOfComponents());
+    return m_FeatureData->getPointer(static_cast<size_t>(m_FeatureIds->getValue(i)) * numComp);
+  }
+
+  /**
+   * @brief Returns component j of element i
+   * @param i
+   * @param j
+   * @return
+   */
+  T getComponent(size_t i, int j) const
+  {
+    return getTuplePointer(i)[j];
+  }
+
+  /**
+   * @brief Copies the elements [start, end) into dest, which must hold (end - start) * number of
+   * components values. Calls with disjoint ranges may run concurrently.
+   * @param start
+   * @param end
+   * @param dest
+   */
+  void gather(size_t start, size_t end, T* dest) const
+  {
+    const T* src = m_FeatureData->getPointer(0);
+    const int32_t* ids = m_FeatureIds->getPointer(0);
+    switch(m_FeatureData->getNumberOfComponents())
+    {
+    case 1:
+      GatherTuples<1>(src, ids, start, end, dest);
+      break;
+    case 2:
+      GatherTuples<2>(src, ids, start, end, dest);
+      break;
+    case 3:
+      GatherTuples<3>(src, ids, start, end, dest);
+      break;
+    case 4:
+      GatherTuples<4>(src, ids, start, end, dest);
+      break;
+    case 6:
+      GatherTuples<6>(src, ids, start, end, dest);
+      break;
+    case 9:
+      GatherTuples<9>(src, ids, start, end, dest);
+      break;
+    default:
+    {
+      size_t numComp = static_cast<size_t>(m_FeatureData->getNumberOfComponents());
+      for(size_t i = start; i < end; i++)
+      {
+        const T* tuple = src + static_cast<size_t>(ids[i]) * numComp;
+        std::copy(tuple, tuple + numComp, dest + (i - start) * numComp);
+      }
+    }
+    break;
+    }
+  }
+
+  /**
+   * @brief Returns the Feature array
+   * @return
+   */
+  typename FeatureArrayType::Pointer getFeatureData() const
+  {
+    return m_FeatureData;
+  }
+
+  /**
+   * @brief Returns the Feature Ids array
+   * @return
+   */
+  Int32ArrayType::Pointer getFeatureIds() const
+  {
+    return m_FeatureIds;
+  }
+
+protected:
+  /**
+   * @brief Copies tuples with a component count that is known at compile time so the inner
+   * loop is unrolled into plain loads and stores
+   */
+  template <size_t NumComp> static void GatherTuples(const T* src, const int32_t* ids, size_t start, size_t end, T* dest)
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      const T* tuple = src + static_cast<size_t>(ids[i]) * NumComp;
+      for(size_t c = 0; c < NumComp; c++)
+      {
+        dest[c] = tuple[c];
+      }
+      dest += NumComp;
+    }
+  }
+
+private:
+  typename FeatureArrayType::Pointer m_FeatureData;
+  Int32ArrayType::Pointer m_FeatureIds;
+};
@@ -28,3 +28,29 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
 {
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t IDataArray::compactTuples(const bool* mask)
+{
+  QVector<size_t> idxs;
+  size_t numTuples = getNumberOfTuples();
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    if(!mask[i])
+    {
+      idxs.push_back(i);
+    }
+  }
+  if(idxs.empty())
+  {
+    return 0;
+  }
+  int err = eraseTuples(idxs);
+  if(err < 0)
+  {
+    return err;
+  }
+  return idxs.size();
+}
@@ -146,6 +146,14 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs) = 0;
 
+    /**
+     * @brief Removes every tuple whose mask value is false and keeps the others in their current
+     * order. The default implementation hands the removed indices to eraseTuples().
+     * @param mask One value per tuple
+     * @return The number of tuples that were removed, or a negative value on error
+     */
+    virtual int64_t compactTuples(const bool* mask);
+
     /**
      * @brief Copies a Tuple from one position to another.
      * @param currentPos The index of the source data
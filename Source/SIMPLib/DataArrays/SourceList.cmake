@@ -3,7 +3,11 @@ set(SUBDIR_NAME DataArrays)
 
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitMaskArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayBulkOps.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FeatureDataView.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
@@ -14,6 +18,8 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitMaskArray.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayStorage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
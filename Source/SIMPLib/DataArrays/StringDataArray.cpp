@@ -34,9 +34,19 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
+namespace
+{
+// The byte buffer is not compacted while it is smaller than this
+const size_t k_MinCompactBytes = 64 * 1024;
+} // namespace
+
 
 // -----------------------------------------------------------------------------
 //
@@ -56,7 +66,8 @@ StringDataArray::StringDataArray(size_t numTuples, const QString name, bool allo
 {
   // if (allocate == true)
   {
-    m_Array.resize(numTuples);
+    m_Offsets.resize(numTuples, 0);
+    m_Lengths.resize(numTuples, 0);
   }
 }
 
@@ -197,7 +208,11 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  if(m_Lengths[i] == 0)
+  {
+    return nullptr;
+  }
+  return static_cast<void*>(m_Buffer.data() + m_Offsets[i]);
 }
 
 // -----------------------------------------------------------------------------
@@ -205,7 +220,7 @@ void* StringDataArray::getVoidPointer(size_t i)
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getNumberOfTuples()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -213,7 +228,7 @@ size_t StringDataArray::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getSize()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -253,7 +268,7 @@ int StringDataArray::getRank()
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getTypeSize()
 {
-  return sizeof(QString);
+  return sizeof(char);
 }
 
 // -----------------------------------------------------------------------------
@@ -278,35 +293,48 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
+  size_t numTuples = getNumberOfTuples();
+  std::unique_ptr<bool[]> mask(new bool[numTuples]);
+  std::fill(mask.get(), mask.get() + numTuples, true);
   for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
   {
-    if(idxs[i] >= static_cast<size_t>(m_Array.size()))
+    if(idxs[i] >= numTuples)
     {
       return -100;
     }
+    mask[idxs[i]] = false;
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  compactTuples(mask.get());
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t StringDataArray::compactTuples(const bool* mask)
+{
+  // Only the offsets and lengths move. The bytes of the removed values become
+  // garbage in the buffer until it is worth compacting.
+  size_t numTuples = getNumberOfTuples();
+  size_t numKept = 0;
+  for(size_t i = 0; i < numTuples; i++)
   {
-    bool keep = true;
-    for(QVector<size_t>::size_type j = start; j < idxs.size(); ++j)
+    if(mask[i])
     {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
+      m_Offsets[numKept] = m_Offsets[i];
+      m_Lengths[numKept] = m_Lengths[i];
+      numKept++;
     }
-    if(keep)
+    else if(m_Lengths[i] > 0)
     {
-      newArray.push_back(m_Array[i]);
+      m_LiveBytes -= m_Lengths[i] + 1;
     }
   }
-  m_Array = newArray;
-  return err;
+  m_Offsets.resize(numKept);
+  m_Lengths.resize(numKept);
+  reclaimBuffer();
+  return static_cast<int64_t>(numTuples - numKept);
 }
 
 // -----------------------------------------------------------------------------
@@ -314,16 +342,25 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
 // -----------------------------------------------------------------------------
 int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 {
-  if(currentPos >= m_Array.size())
+  if(currentPos >= getNumberOfTuples())
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= getNumberOfTuples())
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  // Values are never modified in place so both tuples can share the same bytes
+  if(m_Lengths[newPos] > 0)
+  {
+    m_LiveBytes -= m_Lengths[newPos] + 1;
+  }
+  m_Offsets[newPos] = m_Offsets[currentPos];
+  m_Lengths[newPos] = m_Lengths[currentPos];
+  if(m_Lengths[newPos] > 0)
+  {
+    m_LiveBytes += m_Lengths[newPos] + 1;
+  }
   return 0;
 }
 
@@ -332,7 +369,7 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 // -----------------------------------------------------------------------------
 bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
-  if(destTupleOffset >= m_Array.size())
+  if(destTupleOffset >= getNumberOfTuples())
   {
     return false;
   }
@@ -342,19 +379,23 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
   }
 
   Self* source = dynamic_cast<Self*>(sourceArray.get());
+  if(nullptr == source)
+  {
+    return false;
+  }
 
   if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > getNumberOfTuples())
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    setValue(destTupleOffset + i, source->getUtf8Data(srcTupleOffset + i), source->getUtf8Length(srcTupleOffset + i));
   }
   return true;
 }
@@ -364,7 +405,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<QString*>(value));
+  setValue(pos, *(reinterpret_cast<QString*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -372,7 +413,11 @@ void StringDataArray::initializeTuple(size_t pos, void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  m_Buffer.clear();
+  m_Buffer.shrink_to_fit();
+  m_Offsets.assign(m_Offsets.size(), 0);
+  m_Lengths.assign(m_Lengths.size(), 0);
+  m_LiveBytes = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -380,7 +425,7 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(QString value)
 {
-  m_Array.assign(m_Array.size(), value);
+  initializeWithValue(value.toStdString());
 }
 
 // -----------------------------------------------------------------------------
@@ -388,7 +433,17 @@ void StringDataArray::initializeWithValue(QString value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  initializeWithZeros();
+  if(value.empty())
+  {
+    return;
+  }
+  // Every tuple shares a single copy of the value
+  m_Buffer.assign(value.begin(), value.end());
+  m_Buffer.push_back('\0');
+  m_Offsets.assign(m_Offsets.size(), 0);
+  m_Lengths.assign(m_Lengths.size(), value.size());
+  m_LiveBytes = m_Lengths.size() * (value.size() + 1);
 }
 
 // -----------------------------------------------------------------------------
@@ -399,10 +454,10 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName());
   if(forceNoAllocate == false)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->m_Buffer = m_Buffer;
+    daCopy->m_Offsets = m_Offsets;
+    daCopy->m_Lengths = m_Lengths;
+    daCopy->m_LiveBytes = m_LiveBytes;
   }
   return daCopy;
 }
@@ -412,8 +467,7 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resizeTotalElements(size_t size)
 {
-  m_Array.resize(size);
-  return 1;
+  return resize(size);
 }
 
 // -----------------------------------------------------------------------------
@@ -421,7 +475,16 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resize(size_t numTuples)
 {
-  m_Array.resize(numTuples);
+  for(size_t i = numTuples; i < m_Lengths.size(); i++)
+  {
+    if(m_Lengths[i] > 0)
+    {
+      m_LiveBytes -= m_Lengths[i] + 1;
+    }
+  }
+  m_Offsets.resize(numTuples, 0);
+  m_Lengths.resize(numTuples, 0);
+  reclaimBuffer();
   return 1;
 }
 
@@ -430,9 +493,13 @@ int32_t StringDataArray::resize(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(m_Array.size() > 0)
+  if(m_Offsets.size() > 0)
   {
-    m_Array.clear();
+    m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
+    m_Offsets.clear();
+    m_Lengths.clear();
+    m_LiveBytes = 0;
     this->_ownsData = true;
   }
 }
@@ -442,7 +509,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -450,7 +517,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -514,42 +581,151 @@ int StringDataArray::readH5Data(hid_t parentId)
 {
   int err = 0;
   this->resize(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), buffer, offsets);
+  // The strings come back packed in the same layout this class uses so the
+  // buffer is taken over without copying.
+  adoptBuffer(buffer, offsets);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValue(size_t i, const QString& value)
+{
+  QByteArray utf8 = value.toUtf8();
+  setValue(i, utf8.constData(), static_cast<size_t>(utf8.size()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValue(size_t i, const std::string& value)
+{
+  setValue(i, value.data(), value.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValue(size_t i, const char* utf8, size_t length)
+{
+  if(m_Lengths[i] > 0)
+  {
+    m_LiveBytes -= m_Lengths[i] + 1;
+  }
+  if(length == 0)
+  {
+    m_Offsets[i] = 0;
+    m_Lengths[i] = 0;
+    reclaimBuffer();
+    return;
+  }
 
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+  // The new value is always appended. The old bytes may be shared with other
+  // tuples and are reclaimed by the next compaction.
+  size_t pos = m_Buffer.size();
+  bool aliased = !m_Buffer.empty() && utf8 >= m_Buffer.data() && utf8 < m_Buffer.data() + pos;
+  size_t srcOffset = aliased ? static_cast<size_t>(utf8 - m_Buffer.data()) : 0;
+  m_Buffer.resize(pos + length + 1);
+  if(aliased)
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    utf8 = m_Buffer.data() + srcOffset;
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+  std::memcpy(m_Buffer.data() + pos, utf8, length);
+  m_Buffer[pos + length] = '\0';
+  m_Offsets[i] = pos;
+  m_Lengths[i] = length;
+  m_LiveBytes += length + 1;
+  reclaimBuffer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString StringDataArray::getValue(size_t i)
+{
+  size_t length = m_Lengths.at(i);
+  if(length == 0)
   {
-    return -1;
+    return QString();
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+  return QString::fromUtf8(m_Buffer.data() + m_Offsets[i], static_cast<int>(length));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* StringDataArray::getUtf8Data(size_t i) const
+{
+  if(m_Lengths[i] == 0)
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    return "";
   }
-#endif
-  return err;
+  return m_Buffer.data() + m_Offsets[i];
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void StringDataArray::setValue(size_t i, const QString& value)
+size_t StringDataArray::getUtf8Length(size_t i) const
 {
-  m_Array[i] = value;
+  return m_Lengths[i];
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QString StringDataArray::getValue(size_t i)
+void StringDataArray::compactBuffer()
+{
+  std::vector<char> buffer;
+  buffer.reserve(m_LiveBytes);
+  for(size_t i = 0; i < m_Offsets.size(); i++)
+  {
+    if(m_Lengths[i] == 0)
+    {
+      m_Offsets[i] = 0;
+      continue;
+    }
+    const char* src = m_Buffer.data() + m_Offsets[i];
+    m_Offsets[i] = buffer.size();
+    buffer.insert(buffer.end(), src, src + m_Lengths[i] + 1);
+  }
+  m_Buffer.swap(buffer);
+  m_LiveBytes = m_Buffer.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::reclaimBuffer()
 {
-  return m_Array.at(i);
+  if(m_LiveBytes == 0)
+  {
+    m_Buffer.clear();
+    return;
+  }
+  if(m_Buffer.size() > k_MinCompactBytes && m_Buffer.size() > 2 * m_LiveBytes)
+  {
+    compactBuffer();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::adoptBuffer(std::vector<char>& buffer, const std::vector<size_t>& offsets)
+{
+  m_Buffer.swap(buffer);
+  m_Offsets = offsets;
+  m_Lengths.resize(offsets.size());
+  for(size_t i = 0; i < offsets.size(); i++)
+  {
+    size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : m_Buffer.size();
+    m_Lengths[i] = end - offsets[i] - 1;
+  }
+  m_LiveBytes = m_Buffer.size();
+  reclaimBuffer();
 }
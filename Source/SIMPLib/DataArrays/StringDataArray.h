@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -48,7 +49,12 @@
 
 /**
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
- * @brief Stores an array of QString objects
+ * @brief Stores an array of strings.
+ *
+ * The strings are kept as UTF-8 in one contiguous byte buffer. Each value is
+ * null terminated and addressed by an offset and a length, so there is no heap
+ * allocation per value. getValue()/setValue() convert to and from QString. Hot
+ * loops can use getUtf8Data()/getUtf8Length() to read a value without copying.
  *
  * @date Nov 13, 2012
  * @version 1.0
@@ -164,8 +170,8 @@ public:
    */
   void releaseOwnership() override;
   /**
-   * @brief Returns a void pointer pointing to the index of the array. nullptr
-   * pointers are entirely possible. No checks are performed to make sure
+   * @brief Returns a void pointer pointing to the UTF-8 bytes of the value at
+   * the index. Empty values return nullptr. No checks are performed to make sure
    * the index is with in the range of the internal data array.
    * @param i The index to have the returned pointer pointing to.
    * @return Void Pointer. Possibly nullptr.
@@ -199,7 +205,8 @@ public:
   int getRank();
 
   /**
-   * @brief Returns the number of bytes that make up the data type.
+   * @brief Returns the number of bytes that make up the data type. The values
+   * are stored as UTF-8 so this is always 1.
    * 1 = char
    * 2 = 16 bit integer
    * 4 = 32 bit integer/Float
@@ -217,6 +224,13 @@ public:
    */
   int eraseTuples(QVector<size_t>& idxs) override;
 
+  /**
+   * @brief Keeps the tuples whose mask entry is true and removes the rest.
+   * @param mask One entry per tuple
+   * @return The number of tuples that were removed
+   */
+  int64_t compactTuples(const bool* mask) override;
+
   /**
    * @brief Copies a Tuple from one position to another.
    * @param currentPos The index of the source data
@@ -367,6 +381,37 @@ public:
    */
   QString getValue(size_t i);
 
+  /**
+   * @brief Sets the value at the index from UTF-8 bytes. The bytes may point into
+   * this array.
+   * @param i
+   * @param utf8
+   * @param length The number of bytes, not counting any null terminator
+   */
+  void setValue(size_t i, const char* utf8, size_t length);
+
+  /**
+   * @brief setValue
+   * @param i
+   * @param value UTF-8 encoded value
+   */
+  void setValue(size_t i, const std::string& value);
+
+  /**
+   * @brief Returns the null terminated UTF-8 bytes of the value at the index. The
+   * pointer is only valid until the array is next modified.
+   * @param i
+   * @return
+   */
+  const char* getUtf8Data(size_t i) const;
+
+  /**
+   * @brief Returns the number of UTF-8 bytes of the value at the index.
+   * @param i
+   * @return
+   */
+  size_t getUtf8Length(size_t i) const;
+
 protected:
   /**
    * @brief Protected Constructor
@@ -378,9 +423,31 @@ protected:
   StringDataArray();
 
 private:
+  /**
+   * @brief Rewrites the byte buffer so that it only holds the values that are
+   * still referenced.
+   */
+  void compactBuffer();
+
+  /**
+   * @brief Calls compactBuffer() once more than half of the byte buffer is no
+   * longer referenced.
+   */
+  void reclaimBuffer();
+
+  /**
+   * @brief Takes over a buffer of null terminated strings stored back to back
+   * @param buffer
+   * @param offsets The start of each string in the buffer
+   */
+  void adoptBuffer(std::vector<char>& buffer, const std::vector<size_t>& offsets);
+
   QString m_Name;
   QString m_InitValue;
-  std::vector<QString> m_Array;
+  std::vector<char> m_Buffer;
+  std::vector<size_t> m_Offsets;
+  std::vector<size_t> m_Lengths;
+  size_t m_LiveBytes = 0;
   bool _ownsData;
 
 public:
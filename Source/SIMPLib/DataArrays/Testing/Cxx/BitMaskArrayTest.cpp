@@ -0,0 +1,349 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/DataArrays/BitMaskArray.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+const QString kMaskName("Test Mask");
+
+class BitMaskArrayTest
+{
+public:
+  // Not a multiple of 64 so the last word is only partly used
+  const size_t k_ArraySize = 1000;
+
+  BitMaskArrayTest() = default;
+  virtual ~BitMaskArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::BitMaskArrayTest::TestFile);
+    QDir tempDir(UnitTest::BitMaskArrayTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  static bool Pattern(size_t i)
+  {
+    return (i % 3 == 0) || (i % 7 == 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BoolArrayType::Pointer createBoolArray()
+  {
+    BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(k_ArraySize, kMaskName);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      boolArray->setValue(i, Pattern(i));
+    }
+    return boolArray;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConversion()
+  {
+    BoolArrayType::Pointer boolArray = createBoolArray();
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(boolArray);
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), (k_ArraySize + 63) / 64)
+    DREAM3D_REQUIRE_EQUAL(mask->getName(), kMaskName)
+    DREAM3D_REQUIRE_EQUAL(mask->getTypeAsString(), QString("BitMaskArray"))
+
+    // Only the start of the packed words has an address
+    DREAM3D_REQUIRE(mask->getVoidPointer(0) == static_cast<void*>(mask->getWordPointer(0)))
+    DREAM3D_REQUIRE(mask->getVoidPointer(1) == nullptr)
+    DREAM3D_REQUIRE(mask->getVoidPointer(64) == nullptr)
+
+    size_t expected = 0;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), Pattern(i))
+      expected += Pattern(i) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(mask->countSetBits(), expected)
+
+    BoolArrayType::Pointer roundTrip = mask->toBoolArray();
+    DREAM3D_REQUIRE_EQUAL(roundTrip->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(roundTrip->getValue(i), boolArray->getValue(i))
+    }
+
+    // Unaligned ranges go through the partial word path
+    BitMaskArray::Pointer partial = BitMaskArray::CreateArray(k_ArraySize, kMaskName);
+    DREAM3D_REQUIRE_EQUAL(partial->copyFromArray(5, boolArray, 10, 900), true)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      bool value = (i >= 5 && i < 905) ? Pattern(i + 5) : false;
+      DREAM3D_REQUIRE_EQUAL(partial->getValue(i), value)
+    }
+
+    BoolArrayType::Pointer vectorArray = BoolArrayType::CreateArray(k_ArraySize, QVector<size_t>(1, 3), kMaskName);
+    BitMaskArray::Pointer invalid = BitMaskArray::FromBoolArray(vectorArray);
+    DREAM3D_REQUIRE_NULL_POINTER(invalid.get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBitwiseOperations()
+  {
+    BitMaskArray::Pointer a = BitMaskArray::CreateArray(k_ArraySize, kMaskName);
+    BitMaskArray::Pointer b = BitMaskArray::CreateArray(k_ArraySize, kMaskName);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      a->setValue(i, i % 2 == 0);
+      b->setValue(i, i % 5 == 0);
+    }
+
+    BitMaskArray::Pointer andMask = std::dynamic_pointer_cast<BitMaskArray>(a->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(andMask->bitwiseAnd(*b), true)
+    BitMaskArray::Pointer orMask = std::dynamic_pointer_cast<BitMaskArray>(a->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(orMask->bitwiseOr(*b), true)
+    BitMaskArray::Pointer notMask = std::dynamic_pointer_cast<BitMaskArray>(a->deepCopy());
+    notMask->invert();
+
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(andMask->getValue(i), (i % 10 == 0))
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), (i % 2 == 0 || i % 5 == 0))
+      DREAM3D_REQUIRE_EQUAL(notMask->getValue(i), (i % 2 != 0))
+    }
+    DREAM3D_REQUIRE_EQUAL(andMask->countSetBits(), k_ArraySize / 10)
+    // The unused bits of the last word must stay clear
+    DREAM3D_REQUIRE_EQUAL(notMask->countSetBits(), k_ArraySize / 2)
+
+    BitMaskArray::Pointer smaller = BitMaskArray::CreateArray(k_ArraySize - 1, kMaskName);
+    DREAM3D_REQUIRE_EQUAL(a->bitwiseAnd(*smaller), false)
+    DREAM3D_REQUIRE_EQUAL(a->bitwiseOr(*smaller), false)
+
+    a->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(a->countSetBits(), k_ArraySize)
+    a->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(a->countSetBits(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSetBitIteration()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(createBoolArray());
+    std::vector<size_t> visited;
+    mask->forEachSetBit([&](size_t i) { visited.push_back(i); });
+
+    std::vector<size_t> expected;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      if(Pattern(i))
+      {
+        expected.push_back(i);
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(visited.size(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(visited[i], expected[i])
+    }
+
+    // Runs of empty words and the tail are skipped
+    BitMaskArray::Pointer sparse = BitMaskArray::CreateArray(k_ArraySize, kMaskName);
+    DREAM3D_REQUIRE_EQUAL(sparse->findNextSetBit(0), k_ArraySize)
+    sparse->setValue(700, true);
+    sparse->setValue(999, true);
+    DREAM3D_REQUIRE_EQUAL(sparse->findNextSetBit(0), 700)
+    DREAM3D_REQUIRE_EQUAL(sparse->findNextSetBit(701), 999)
+    DREAM3D_REQUIRE_EQUAL(sparse->findNextSetBit(1000), k_ArraySize)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestEraseAndResize()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(createBoolArray());
+    std::vector<bool> reference;
+    QVector<size_t> idxs;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      if(i % 4 == 1 || (i >= 128 && i < 256))
+      {
+        idxs.push_back(i);
+      }
+      else
+      {
+        reference.push_back(Pattern(i));
+      }
+    }
+    int err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), reference.size())
+    size_t expected = 0;
+    for(size_t i = 0; i < reference.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), reference[i])
+      expected += reference[i] ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(mask->countSetBits(), expected)
+
+    idxs.clear();
+    idxs.push_back(k_ArraySize);
+    err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+
+    // Whole words that are kept are shifted into place behind the partly kept first word
+    mask = BitMaskArray::FromBoolArray(createBoolArray());
+    std::unique_ptr<bool[]> keep(new bool[k_ArraySize]);
+    std::fill(keep.get(), keep.get() + k_ArraySize, true);
+    keep[3] = false;
+    int64_t removed = mask->compactTuples(keep.get());
+    DREAM3D_REQUIRE_EQUAL(removed, 1)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_ArraySize - 1)
+    for(size_t i = 0; i < k_ArraySize - 1; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), Pattern(i < 3 ? i : i + 1))
+    }
+
+    // As many indices as tuples clears the mask
+    idxs = QVector<size_t>(static_cast<int>(k_ArraySize), 0);
+    err = mask->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 0)
+
+    // Growing the mask adds false values
+    mask = BitMaskArray::FromBoolArray(createBoolArray());
+    mask->resize(10);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 10)
+    mask->resize(k_ArraySize);
+    for(size_t i = 10; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), false)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReadWriteHDF5()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::FromBoolArray(createBoolArray());
+    QVector<size_t> tDims = {10, 100};
+
+    hid_t fileId = QH5Utilities::createFile(UnitTest::BitMaskArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0);
+    H5ScopedFileSentinel sentinel(&fileId, false);
+
+    int err = mask->writeH5Data(fileId, tDims);
+    DREAM3D_REQUIRE(err >= 0);
+
+    IDataArray::Pointer iDataArray = H5DataArrayReader::ReadBitMaskArray(fileId, kMaskName);
+    BitMaskArray::Pointer readMask = std::dynamic_pointer_cast<BitMaskArray>(iDataArray);
+    DREAM3D_REQUIRE_VALID_POINTER(readMask.get())
+    DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readMask->getValue(i), mask->getValue(i))
+    }
+
+    // Read back rows 20 to 49 of the 10 x 100 tuple grid
+    QVector<size_t> tupleOffset = {0, 20};
+    QVector<size_t> tupleCount = {10, 30};
+    iDataArray = H5DataArrayReader::ReadBitMaskArray(fileId, kMaskName, false, tupleOffset, tupleCount);
+    readMask = std::dynamic_pointer_cast<BitMaskArray>(iDataArray);
+    DREAM3D_REQUIRE_VALID_POINTER(readMask.get())
+    DREAM3D_REQUIRE_EQUAL(readMask->getNumberOfTuples(), 300)
+    for(size_t i = 0; i < 300; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readMask->getValue(i), Pattern(200 + i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    QDir dir(UnitTest::BitMaskArrayTest::TestDir);
+    dir.mkpath(".");
+    std::cout << "#### BitMaskArrayTest Starting ####" << std::endl;
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestConversion())
+    DREAM3D_REGISTER_TEST(TestBitwiseOperations())
+    DREAM3D_REGISTER_TEST(TestSetBitIteration())
+    DREAM3D_REGISTER_TEST(TestEraseAndResize())
+    DREAM3D_REGISTER_TEST(TestReadWriteHDF5())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  BitMaskArrayTest(const BitMaskArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const BitMaskArrayTest&);   // Move assignment Not Implemented
+};
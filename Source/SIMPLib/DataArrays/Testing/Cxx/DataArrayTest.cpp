@@ -1126,6 +1126,239 @@ public:
     TestWrapPointerForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryMappedStorage()
+  {
+    QVector<size_t> cDims = {3};
+    Int32ArrayType::Pointer mapped = Int32ArrayType::CreateArray(1000, cDims, "Mapped", false);
+    mapped->setStoragePolicy(DataArrayStorage::Policy::MemoryMapped);
+    DREAM3D_REQUIRE(mapped->allocate() > 0);
+    DREAM3D_REQUIRE_EQUAL(mapped->isMemoryMapped(), true);
+    for(size_t i = 0; i < mapped->getSize(); i++)
+    {
+      mapped->setValue(i, static_cast<int32_t>(i));
+    }
+
+    // Growing a mapped array remaps the scratch file and keeps the values
+    mapped->resize(5000);
+    DREAM3D_REQUIRE_EQUAL(mapped->isMemoryMapped(), true);
+    DREAM3D_REQUIRE_EQUAL(mapped->getNumberOfTuples(), 5000);
+    for(size_t i = 0; i < 3000; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mapped->getValue(i), static_cast<int32_t>(i));
+    }
+
+    IDataArray::Pointer copy = mapped->deepCopy();
+    Int32ArrayType::Pointer mappedCopy = std::dynamic_pointer_cast<Int32ArrayType>(copy);
+    DREAM3D_REQUIRE_EQUAL(mappedCopy->isMemoryMapped(), true);
+    DREAM3D_REQUIRE_EQUAL(::memcmp(mappedCopy->getPointer(0), mapped->getPointer(0), mapped->getSize() * sizeof(int32_t)), 0);
+
+    QVector<size_t> idxs = {0, 10, 4999};
+    DREAM3D_REQUIRE_EQUAL(mapped->eraseTuples(idxs), 0);
+    DREAM3D_REQUIRE_EQUAL(mapped->isMemoryMapped(), true);
+    DREAM3D_REQUIRE_EQUAL(mapped->getSize(), 4997 * 3);
+    DREAM3D_REQUIRE_EQUAL(mapped->getValue(0), 3);
+
+    // Releasing ownership moves the values out of the scratch file so the new owner can free() them
+    mapped->releaseOwnership();
+    DREAM3D_REQUIRE_EQUAL(mapped->isMemoryMapped(), false);
+    int32_t* released = mapped->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(DataArrayStorage::IsMemoryMapped(released), false);
+    for(size_t i = 0; i < mapped->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(released[i], mappedCopy->getValue(i < 27 ? i + 3 : i + 6));
+    }
+    mapped = Int32ArrayType::NullPointer();
+    free(released);
+
+    // Arrays at or above the threshold are mapped unless they ask for the heap
+    size_t threshold = DataArrayStorage::GetMemoryMapThreshold();
+    DataArrayStorage::SetMemoryMapThreshold(1024 * sizeof(float));
+    FloatArrayType::Pointer small = FloatArrayType::CreateArray(100, "Small", true);
+    FloatArrayType::Pointer large = FloatArrayType::CreateArray(4096, "Large", true);
+    FloatArrayType::Pointer heap = FloatArrayType::CreateArray(4096, "Heap", false);
+    heap->setStoragePolicy(DataArrayStorage::Policy::Heap);
+    heap->allocate();
+    DataArrayStorage::SetMemoryMapThreshold(threshold);
+    DREAM3D_REQUIRE_EQUAL(small->isMemoryMapped(), false);
+    DREAM3D_REQUIRE_EQUAL(large->isMemoryMapped(), true);
+    DREAM3D_REQUIRE_EQUAL(heap->isMemoryMapped(), false);
+    large->initializeWithValue(1.5f);
+    DREAM3D_REQUIRE_EQUAL(large->getValue(4095), 1.5f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestBulkOperationsForType()
+  {
+    // Large enough to be split across several threads
+    const size_t numTuples = 200000;
+    QVector<size_t> cDims = {3};
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, cDims, "Bulk", true);
+    for(size_t t = 0; t < numTuples; t++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        array->setComponent(t, c, static_cast<T>(t % 100 + c));
+      }
+    }
+
+    // Fill a range of tuples
+    DREAM3D_REQUIRE_EQUAL(array->fillTuples(10, 5, static_cast<T>(7)), true);
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(9, 2), static_cast<T>(11));
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(10, 0), static_cast<T>(7));
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(14, 2), static_cast<T>(7));
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(15, 0), static_cast<T>(15));
+    DREAM3D_REQUIRE_EQUAL(array->fillTuples(numTuples - 1, 2, static_cast<T>(7)), false);
+
+    // Gather the tuples in reverse order, then scatter them back
+    std::vector<int32_t> indices(numTuples);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      indices[i] = static_cast<int32_t>(numTuples - 1 - i);
+    }
+    typename DataArray<T>::Pointer reversed = DataArray<T>::CreateArray(numTuples, cDims, "Reversed", true);
+    DREAM3D_REQUIRE_EQUAL(reversed->gatherTuples(*array, indices.data(), indices.size()), true);
+    DREAM3D_REQUIRE_EQUAL(reversed->getComponent(0, 1), array->getComponent(numTuples - 1, 1));
+    DREAM3D_REQUIRE_EQUAL(reversed->getComponent(numTuples - 12, 0), static_cast<T>(7));
+    typename DataArray<T>::Pointer restored = DataArray<T>::CreateArray(numTuples, cDims, "Restored", true);
+    DREAM3D_REQUIRE_EQUAL(restored->scatterTuples(*reversed, indices.data(), indices.size()), true);
+    DREAM3D_REQUIRE_EQUAL(::memcmp(restored->getPointer(0), array->getPointer(0), array->getSize() * sizeof(T)), 0);
+
+    indices[5] = -1;
+    DREAM3D_REQUIRE_EQUAL(reversed->gatherTuples(*array, indices.data(), indices.size()), false);
+    indices[5] = static_cast<int32_t>(numTuples);
+    DREAM3D_REQUIRE_EQUAL(restored->scatterTuples(*reversed, indices.data(), indices.size()), false);
+
+    // Keep every third tuple
+    std::unique_ptr<bool[]> mask(new bool[numTuples]);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      mask[i] = (i % 3 == 0);
+    }
+    int64_t removed = restored->compactTuples(mask.get());
+    DREAM3D_REQUIRE_EQUAL(removed, static_cast<int64_t>(numTuples - (numTuples + 2) / 3));
+    DREAM3D_REQUIRE_EQUAL(restored->getNumberOfTuples(), (numTuples + 2) / 3);
+    for(size_t i = 0; i < restored->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(restored->getComponent(i, 2), array->getComponent(i * 3, 2));
+    }
+
+    // Erase indices that are neither sorted nor unique
+    QVector<size_t> idxs = {8, 2, 8, 0};
+    DREAM3D_REQUIRE_EQUAL(restored->eraseTuples(idxs), 0);
+    DREAM3D_REQUIRE_EQUAL(restored->getNumberOfTuples(), (numTuples + 2) / 3 - 3);
+    DREAM3D_REQUIRE_EQUAL(restored->getComponent(0, 0), array->getComponent(3, 0));
+    DREAM3D_REQUIRE_EQUAL(restored->getComponent(1, 0), array->getComponent(9, 0));
+    DREAM3D_REQUIRE_EQUAL(restored->getComponent(5, 0), array->getComponent(27, 0));
+
+    // Swapping twice restores the original bytes
+    typename DataArray<T>::Pointer swapped = std::dynamic_pointer_cast<DataArray<T>>(array->deepCopy());
+    swapped->byteSwapElements();
+    if(sizeof(T) > 1)
+    {
+      DREAM3D_REQUIRE(::memcmp(swapped->getPointer(0), array->getPointer(0), array->getSize() * sizeof(T)) != 0);
+    }
+    swapped->byteSwapElements();
+    DREAM3D_REQUIRE_EQUAL(::memcmp(swapped->getPointer(0), array->getPointer(0), array->getSize() * sizeof(T)), 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBulkOperations()
+  {
+    TestBulkOperationsForType<uint8_t>();
+    TestBulkOperationsForType<int16_t>();
+    TestBulkOperationsForType<uint32_t>();
+    TestBulkOperationsForType<int64_t>();
+    TestBulkOperationsForType<float>();
+    TestBulkOperationsForType<double>();
+
+    UInt16ArrayType::Pointer shorts = UInt16ArrayType::CreateArray(2, "Shorts", true);
+    shorts->setValue(0, 0x0102);
+    shorts->setValue(1, 0xA0B0);
+    shorts->byteSwapElements();
+    DREAM3D_REQUIRE_EQUAL(shorts->getValue(0), 0x0201);
+    DREAM3D_REQUIRE_EQUAL(shorts->getValue(1), 0xB0A0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    // Compacting a wrapped pointer must leave the caller's memory alone
+    int32_t wrapped[6] = {0, 1, 2, 3, 4, 5};
+    QVector<size_t> cDims = {2};
+    Int32ArrayType::Pointer wrappedArray = Int32ArrayType::WrapPointer(wrapped, 3, cDims, "Wrapped", false);
+    bool wrappedMask[3] = {false, true, true};
+    DREAM3D_REQUIRE_EQUAL(wrappedArray->compactTuples(wrappedMask), 1);
+    DREAM3D_REQUIRE_EQUAL(wrappedArray->getNumberOfTuples(), 2);
+    DREAM3D_REQUIRE_EQUAL(wrappedArray->getValue(0), 2);
+    DREAM3D_REQUIRE_EQUAL(wrapped[0], 0);
+
+    const size_t numFeatures = 100000;
+    QVector<size_t> tDims(1, numFeatures);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "Features", AttributeMatrix::Type::CellFeature);
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(numFeatures, "Ids", true);
+    FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(numFeatures, cDims, "Centroids", true);
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numFeatures, "Neighbors", true);
+    StringDataArray::Pointer names = StringDataArray::CreateArray(numFeatures, "Names", true);
+    QVector<bool> active(numFeatures, true);
+    for(size_t i = 0; i < numFeatures; i++)
+    {
+      ids->setValue(i, static_cast<int32_t>(i));
+      centroids->setComponent(i, 0, static_cast<float>(i));
+      centroids->setComponent(i, 1, static_cast<float>(i) * 2.0f);
+      names->setValue(i, QString::number(i));
+      // Remove every fourth feature, and feature 0 must survive even when flagged
+      active[static_cast<int>(i)] = (i % 4 != 0);
+    }
+    am->addAttributeArray(ids->getName(), ids);
+    am->addAttributeArray(centroids->getName(), centroids);
+    am->addAttributeArray(neighbors->getName(), neighbors);
+    am->addAttributeArray(names->getName(), names);
+
+    const size_t numCells = 300000;
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, "FeatureIds", true);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i % numFeatures));
+    }
+
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get()), true);
+    size_t numKept = 1 + numFeatures - (numFeatures + 3) / 4;
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), numKept);
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("Neighbors"), false);
+    DREAM3D_REQUIRE_EQUAL(ids->getNumberOfTuples(), numKept);
+    DREAM3D_REQUIRE_EQUAL(names->getNumberOfTuples(), numKept);
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(0), 0);
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(1), 1);
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(3), 3);
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(4), 5);
+    DREAM3D_REQUIRE_EQUAL(centroids->getComponent(4, 1), 10.0f);
+    DREAM3D_REQUIRE_EQUAL(names->getValue(4), QString("5"));
+
+    // Removed features map to 0 and the others to their new position
+    for(size_t i = 0; i < numCells; i++)
+    {
+      size_t oldId = i % numFeatures;
+      int32_t expected = (oldId % 4 == 0) ? 0 : static_cast<int32_t>(oldId - oldId / 4);
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expected);
+      if(expected != 0)
+      {
+        DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(ids->getValue(expected)), oldId);
+      }
+    }
+
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, "Cells", AttributeMatrix::Type::Cell);
+    DREAM3D_REQUIRE_EQUAL(cellAm->removeInactiveObjects(active, featureIds.get()), false);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1176,6 +1409,9 @@ public:
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
     DREAM3D_REGISTER_TEST(TestNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
+    DREAM3D_REGISTER_TEST(TestMemoryMappedStorage())
+    DREAM3D_REGISTER_TEST(TestBulkOperations())
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
 
 #if REMOVE_TEST_FILES
@@ -0,0 +1,191 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DynamicListArrayTest
+{
+public:
+  DynamicListArrayTest() = default;
+
+  virtual ~DynamicListArrayTest() = default;
+
+  using ListArrayType = DynamicListArray<uint16_t, int64_t>;
+  using ExpectedLists = std::vector<std::vector<int64_t>>;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ListArrayType::Pointer CreateCompressedLists(const ExpectedLists& lists)
+  {
+    std::vector<uint16_t> linkCounts(lists.size(), 0);
+    for(size_t i = 0; i < lists.size(); i++)
+    {
+      linkCounts[i] = static_cast<uint16_t>(lists[i].size());
+    }
+    ListArrayType::Pointer array = ListArrayType::New();
+    array->allocateCompressedLists(linkCounts);
+    for(size_t i = 0; i < lists.size(); i++)
+    {
+      for(size_t j = 0; j < lists[i].size(); j++)
+      {
+        array->insertCellReference(i, j, lists[i][j]);
+      }
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckLists(ListArrayType::Pointer array, const ExpectedLists& expected)
+  {
+    DREAM3D_REQUIRE_EQUAL(array->size(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(array->getNumberOfElements(i)), expected[i].size())
+      int64_t* cells = array->getElementListPointer(i);
+      for(size_t j = 0; j < expected[i].size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(cells[j], expected[i][j])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The lists of a compressed array sit back to back in one block, empty lists included
+  // -----------------------------------------------------------------------------
+  void TestCompressedLists()
+  {
+    ExpectedLists lists = {{7, 8, 9}, {}, {10, 11}, {}, {12}};
+    ListArrayType::Pointer array = CreateCompressedLists(lists);
+    DREAM3D_REQUIRE(array->isCompressed())
+    CheckLists(array, lists);
+
+    DREAM3D_REQUIRE(array->getElementListPointer(2) == array->getElementListPointer(0) + 3)
+    DREAM3D_REQUIRE(array->getElementListPointer(4) == array->getElementListPointer(2) + 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  // A copy of a compressed array is compressed too and does not share its storage
+  // -----------------------------------------------------------------------------
+  void TestDeepCopy()
+  {
+    ExpectedLists lists = {{7, 8, 9}, {}, {10, 11}, {}, {12}};
+    ListArrayType::Pointer array = CreateCompressedLists(lists);
+
+    ListArrayType::Pointer copy = array->deepCopy();
+    DREAM3D_REQUIRE(copy->isCompressed())
+    CheckLists(copy, lists);
+    DREAM3D_REQUIRE(copy->getElementListPointer(0) != array->getElementListPointer(0))
+
+    copy->insertCellReference(0, 0, 99);
+    CheckLists(array, lists);
+
+    ListArrayType::Pointer empty = array->deepCopy(true);
+    CheckLists(empty, {{}, {}, {}, {}, {}});
+  }
+
+  // -----------------------------------------------------------------------------
+  // Replacing a list with one of the same length stays compressed, any other length
+  // moves every list into its own allocation and keeps their contents
+  // -----------------------------------------------------------------------------
+  void TestSetElementList()
+  {
+    ExpectedLists lists = {{7, 8, 9}, {}, {10, 11}, {}, {12}};
+    ListArrayType::Pointer array = CreateCompressedLists(lists);
+
+    std::vector<int64_t> sameLength = {20, 21};
+    DREAM3D_REQUIRE(array->setElementList(2, static_cast<uint16_t>(sameLength.size()), sameLength.data()))
+    DREAM3D_REQUIRE(array->isCompressed())
+    lists[2] = sameLength;
+    CheckLists(array, lists);
+
+    std::vector<int64_t> newLength = {30, 31, 32, 33};
+    DREAM3D_REQUIRE(array->setElementList(1, static_cast<uint16_t>(newLength.size()), newLength.data()))
+    DREAM3D_REQUIRE_EQUAL(array->isCompressed(), false)
+    lists[1] = newLength;
+    CheckLists(array, lists);
+
+    bool listSet = array->setElementList(5, static_cast<uint16_t>(newLength.size()), newLength.data());
+    DREAM3D_REQUIRE_EQUAL(listSet, false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestEmptyLists()
+  {
+    ExpectedLists lists = {{}, {}, {}};
+    ListArrayType::Pointer array = CreateCompressedLists(lists);
+    DREAM3D_REQUIRE(array->isCompressed())
+    CheckLists(array, lists);
+
+    ListArrayType::Pointer copy = array->deepCopy();
+    DREAM3D_REQUIRE(copy->isCompressed())
+    CheckLists(copy, lists);
+
+    ListArrayType::Pointer none = CreateCompressedLists({});
+    DREAM3D_REQUIRE_EQUAL(none->size(), 0)
+    CheckLists(none->deepCopy(), {});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DynamicListArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCompressedLists());
+    DREAM3D_REGISTER_TEST(TestDeepCopy());
+    DREAM3D_REGISTER_TEST(TestSetElementList());
+    DREAM3D_REGISTER_TEST(TestEmptyLists());
+  }
+
+private:
+  DynamicListArrayTest(const DynamicListArrayTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const DynamicListArrayTest&) = delete;       // Move assignment Not Implemented
+};
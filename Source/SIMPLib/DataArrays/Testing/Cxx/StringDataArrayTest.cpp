@@ -35,6 +35,7 @@
 
 #include <stdlib.h>
 
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -379,6 +380,63 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUtf8Storage()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+
+    // Non-ASCII values survive the round trip through the UTF-8 buffer
+    QString unicode = QString::fromUtf8("Ni\xC3\xB1o \xE2\x82\xAC");
+    nodes->setValue(0, unicode);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), unicode);
+    QByteArray utf8 = unicode.toUtf8();
+    DREAM3D_REQUIRE_EQUAL(nodes->getUtf8Length(0), static_cast<size_t>(utf8.size()));
+    DREAM3D_REQUIRE(std::strcmp(nodes->getUtf8Data(0), utf8.constData()) == 0)
+
+    // Empty values
+    nodes->setValue(1, std::string());
+    DREAM3D_REQUIRE_EQUAL(nodes->getUtf8Length(1), static_cast<size_t>(0));
+    DREAM3D_REQUIRE(std::strcmp(nodes->getUtf8Data(1), "") == 0)
+    DREAM3D_REQUIRE(nodes->getValue(1).isEmpty())
+
+    // Setting a value from another value in the same array
+    nodes->setValue(2, nodes->getUtf8Data(3), nodes->getUtf8Length(3));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), nodes->getValue(3));
+
+    // Copied tuples share storage but can still be changed independently
+    int err = nodes->copyTuple(4, 5);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    nodes->setValue(5, std::string("Changed"));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(4), ::_4);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(5), QString("Changed"));
+
+    // Overwriting values many times must not change what is stored
+    for(int i = 0; i < 100000; i++)
+    {
+      nodes->setValue(6, QString::number(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(6), QString::number(99999));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(7), ::_7);
+
+    bool mask[10] = {true, false, true, false, true, false, true, false, true, false};
+    int64_t removed = nodes->compactTuples(mask);
+    DREAM3D_REQUIRE_EQUAL(removed, 5)
+    DREAM3D_REQUIRE_EQUAL(nodes->getNumberOfTuples(), k_ArraySize - 5);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), unicode);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), ::_3);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), ::_4);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3), QString::number(99999));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(4), ::_8);
+
+    nodes->initializeWithValue(std::string("Same"));
+    for(size_t i = 0; i < nodes->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("Same"));
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -397,6 +455,7 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestUtf8Storage())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -38,15 +38,27 @@
 // C Includes
 
 // C++ Includes
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
 
 // HDF5 Includes
+#include "H5Support/H5Lite.h"
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
 // DREAM3D Includes
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
@@ -334,6 +346,7 @@ int AttributeMatrix::addAttributeArray(const QString& name, IDataArray::Pointer
   Q_ASSERT(getNumberOfTuples() == data->getNumberOfTuples());
 
   m_AttributeArrays[name] = data;
+  m_Revision++;
   return 0;
 }
 
@@ -365,6 +378,7 @@ IDataArray::Pointer AttributeMatrix::removeAttributeArray(const QString& name)
   }
   IDataArray::Pointer p = it.value();
   m_AttributeArrays.erase(it);
+  m_Revision++;
   return p;
 }
 
@@ -395,6 +409,14 @@ RenameErrorCodes AttributeMatrix::renameAttributeArray(const QString& oldname, c
   return NEW_EXISTS;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t AttributeMatrix::getRevision() const
+{
+  return m_Revision;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -429,6 +451,70 @@ size_t AttributeMatrix::getNumberOfTuples()
   return numTuples;
 }
 
+/**
+ * @brief The RemoveInactiveObjectsImpl class runs the compaction of every array of the matrix and
+ * the renumbering of the Feature Ids as one set of independent tasks: task i < arrays.size()
+ * compacts array i and every following task renumbers one block of Feature Ids.
+ */
+class RemoveInactiveObjectsImpl
+{
+public:
+  RemoveInactiveObjectsImpl(const QVector<IDataArray::Pointer>& arrays, const bool* keep, int32_t* featureIds, size_t numFeatureIds, const std::vector<int32_t>& newIds, size_t idBlockSize,
+                            std::atomic<bool>& failed)
+  : m_Arrays(arrays)
+  , m_Keep(keep)
+  , m_FeatureIds(featureIds)
+  , m_NumFeatureIds(numFeatureIds)
+  , m_NewIds(newIds)
+  , m_IdBlockSize(idBlockSize)
+  , m_Failed(failed)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numArrays = static_cast<size_t>(m_Arrays.size());
+    int32_t numIds = static_cast<int32_t>(m_NewIds.size());
+    for(size_t task = start; task < end; task++)
+    {
+      if(task < numArrays)
+      {
+        if(m_Arrays[task]->compactTuples(m_Keep) < 0)
+        {
+          m_Failed = true;
+        }
+        continue;
+      }
+      size_t first = (task - numArrays) * m_IdBlockSize;
+      size_t last = std::min(first + m_IdBlockSize, m_NumFeatureIds);
+      for(size_t i = first; i < last; i++)
+      {
+        int32_t featureId = m_FeatureIds[i];
+        if(featureId >= 0 && featureId < numIds)
+        {
+          m_FeatureIds[i] = m_NewIds[featureId];
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const bool* m_Keep;
+  int32_t* m_FeatureIds;
+  size_t m_NumFeatureIds;
+  const std::vector<int32_t>& m_NewIds;
+  size_t m_IdBlockSize;
+  std::atomic<bool>& m_Failed;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -443,62 +529,79 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
     acceptableMatrix = true;
   }
   size_t totalTuples = getNumberOfTuples();
-  if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix == true)
+  if(static_cast<size_t>(activeObjects.size()) != totalTuples || acceptableMatrix == false)
   {
-    size_t goodcount = 1;
-    QVector<size_t> newNames(totalTuples, 0);
-    QVector<size_t> removeList;
+    return false;
+  }
 
-    for(qint32 i = 1; i < activeObjects.size(); i++)
+  // Tuple 0 is always kept. Every kept tuple gets the next free id and every removed one maps to 0.
+  std::unique_ptr<bool[]> keep(new bool[totalTuples]);
+  std::vector<int32_t> newIds(totalTuples, 0);
+  int32_t goodcount = 1;
+  size_t removeCount = 0;
+  for(size_t i = 0; i < totalTuples; i++)
+  {
+    keep[i] = (i == 0 || activeObjects[static_cast<int>(i)]);
+    if(i == 0)
     {
-      if(activeObjects[i] == false)
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
-      }
-      else
-      {
-        newNames[i] = goodcount;
-        goodcount++;
-      }
+      continue;
     }
-
-    if(removeList.size() > 0)
+    if(keep[i])
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
-      {
-        IDataArray::Pointer p = getAttributeArray(*iter);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
-        {
-          removeAttributeArray(*iter);
-        }
-        else
-        {
-          p->eraseTuples(removeList);
-        }
-      }
-      QVector<size_t> tDims(1, (totalTuples - removeList.size()));
-      setTupleDimensions(tDims);
+      newIds[i] = goodcount;
+      goodcount++;
+    }
+    else
+    {
+      removeCount++;
+    }
+  }
 
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = featureIds->getNumberOfTuples();
-      int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
-      {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
-        {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
-        }
-      }
+  if(removeCount == 0)
+  {
+    return true;
+  }
+
+  QVector<IDataArray::Pointer> arrays;
+  QList<QString> headers = getAttributeArrayNames();
+  for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
+  {
+    IDataArray::Pointer p = getAttributeArray(*iter);
+    QString type = p->getTypeAsString();
+    if(type.compare("NeighborList<T>") == 0)
+    {
+      removeAttributeArray(*iter);
+    }
+    else
+    {
+      arrays.push_back(p);
     }
   }
+
+  // Each array is compacted in place by a single task, while the Feature Ids are renumbered in
+  // blocks alongside them.
+  size_t numFeatureIds = (nullptr != featureIds) ? featureIds->getNumberOfTuples() : 0;
+  int32_t* featureIdPtr = (nullptr != featureIds) ? featureIds->getPointer(0) : nullptr;
+  size_t idBlockSize = 65536;
+  size_t numTasks = static_cast<size_t>(arrays.size()) + (numFeatureIds + idBlockSize - 1) / idBlockSize;
+  std::atomic<bool> failed(false);
+  RemoveInactiveObjectsImpl impl(arrays, keep.get(), featureIdPtr, numFeatureIds, newIds, idBlockSize, failed);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+  if(doParallel && numTasks > 1)
+  {
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, numTasks, 1), impl, tbb::auto_partitioner()); });
+  }
   else
+#endif
   {
-    return false;
+    impl.compute(0, numTasks);
   }
-  return true;
+
+  QVector<size_t> tDims(1, (totalTuples - removeCount));
+  setTupleDimensions(tDims);
+  return !failed;
 }
 
 // -----------------------------------------------------------------------------
@@ -528,6 +631,7 @@ void AttributeMatrix::resizeAttributeArrays(QVector<size_t> tDims)
 void AttributeMatrix::clearAttributeArrays()
 {
   m_AttributeArrays.clear();
+  m_Revision++;
 }
 
 // -----------------------------------------------------------------------------
@@ -571,6 +675,86 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate)
 
   return newAttrMat;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+namespace
+{
+/**
+ * @brief IsUnchangedArray Returns true if the snapshot array describes the same array as the
+ * current one. Arrays that hold data are never considered unchanged because comparing their
+ * contents would cost as much as copying them.
+ */
+bool IsUnchangedArray(const IDataArray::Pointer& current, const IDataArray::Pointer& snapshot)
+{
+  if(nullptr == current.get() || nullptr == snapshot.get())
+  {
+    return false;
+  }
+  if(current->getSize() != 0 && current->isAllocated())
+  {
+    return false;
+  }
+  if(snapshot->getSize() != 0 && snapshot->isAllocated())
+  {
+    return false;
+  }
+  return current->getName() == snapshot->getName() && current->getNameOfClass() == snapshot->getNameOfClass() && current->getTypeAsString() == snapshot->getTypeAsString() &&
+         current->getNumberOfTuples() == snapshot->getNumberOfTuples() && current->getComponentDimensions() == snapshot->getComponentDimensions();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer AttributeMatrix::createSnapshot(const AttributeMatrix::Pointer& previous)
+{
+  bool reusePrevious = (nullptr != previous.get());
+  if(reusePrevious)
+  {
+    reusePrevious = previous->getName() == getName() && previous->getType() == getType() && previous->getTupleDimensions() == getTupleDimensions() &&
+                    previous->m_AttributeArrays.size() == m_AttributeArrays.size();
+  }
+
+  QMap<QString, IDataArray::Pointer> arrays;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    IDataArray::Pointer prevArray = (nullptr == previous.get()) ? IDataArray::NullPointer() : previous->m_AttributeArrays.value(iter.key());
+    if(IsUnchangedArray(iter.value(), prevArray))
+    {
+      arrays.insert(iter.key(), prevArray);
+      continue;
+    }
+    reusePrevious = false;
+    IDataArray::Pointer new_d = iter.value()->deepCopy(false);
+    if(new_d.get() == nullptr)
+    {
+      return AttributeMatrix::NullPointer();
+    }
+    arrays.insert(iter.key(), new_d);
+  }
+
+  if(reusePrevious)
+  {
+    return previous;
+  }
+
+  AttributeMatrix::Pointer newAttrMat = AttributeMatrix::New(getTupleDimensions(), getName(), getType());
+  newAttrMat->m_AttributeArrays = arrays;
+  return newAttrMat;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer AttributeMatrix::shallowCopy()
+{
+  AttributeMatrix::Pointer newAttrMat = AttributeMatrix::New(getTupleDimensions(), getName(), getType());
+  newAttrMat->m_AttributeArrays = m_AttributeArrays;
+  return newAttrMat;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -580,6 +764,9 @@ int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId)
   for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
   {
     IDataArray::Pointer d = iter.value();
+    // The arrays make raw HDF5 calls and may be written from the HDF5 I/O thread. Locking each
+    // array on its own lets other threads use HDF5 between them.
+    std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
     err = d->writeH5Data(parentId, m_TupleDims);
     if(err < 0)
     {
@@ -616,6 +803,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
       dPtr->resize(getNumberOfTuples());
     }
   }
+  else if(classType.compare("BitMaskArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitMaskArray(gid, name, preflight);
+    if(preflight == true && nullptr != dPtr.get())
+    {
+      dPtr->resize(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -650,7 +845,7 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy)
+int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
 {
   int err = 0;
   QMap<QString, DataArrayProxy> dasToRead = attrMatProxy->dataArrays;
@@ -668,18 +863,22 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 
     if(classType.startsWith("DataArray") == true)
     {
-      dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight);
+      dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight, tupleOffset, tupleCount);
     }
     else if(classType.compare("StringDataArray") == 0)
     {
-      dPtr = H5DataArrayReader::ReadStringDataArray(amGid, iter->name, preflight);
+      dPtr = H5DataArrayReader::ReadStringDataArray(amGid, iter->name, preflight, tupleOffset, tupleCount);
+    }
+    else if(classType.compare("BitMaskArray") == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitMaskArray(amGid, iter->name, preflight, tupleOffset, tupleCount);
     }
     else if(classType.compare("vector") == 0)
     {
     }
     else if(classType.compare("NeighborList<T>") == 0)
     {
-      dPtr = H5DataArrayReader::ReadNeighborListData(amGid, iter->name, preflight);
+      dPtr = H5DataArrayReader::ReadNeighborListData(amGid, iter->name, preflight, tupleOffset, tupleCount);
     }
     else if(classType.compare("Statistics") == 0)
     {
@@ -696,6 +895,13 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     //      dPtr = statsData;
     //    }
 
+    // Arrays that could not be cut down to the tuple subregion would not fit this AttributeMatrix
+    if(!tupleOffset.isEmpty() && nullptr != dPtr.get() && dPtr->getNumberOfTuples() != getNumberOfTuples())
+    {
+      H5Gclose(amGid);
+      return -1;
+    }
+
     if(nullptr != dPtr.get())
     {
       addAttributeArray(dPtr->getName(), dPtr);
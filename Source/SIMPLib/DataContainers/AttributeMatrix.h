@@ -259,6 +259,12 @@ public:
     */
     virtual RenameErrorCodes renameAttributeArray(const QString& oldname, const QString& newname, bool overwrite = false);
 
+    /**
+     * @brief Returns a counter that changes every time an array is added, removed or renamed
+     * @return
+     */
+    uint64_t getRevision() const;
+
 
     /**
      * @brief Removes all the Cell Arrays
@@ -559,7 +565,9 @@ public:
     /**
     * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
       (only valid for feature or ensemble type matrices)
-    * @param size The new size of the array
+    * @param activeObjects One flag per tuple; tuple 0 is always kept
+    * @param featureIds The ids that point into this matrix. Ids of removed objects are set to 0.
+    * @return false if the matrix type or size does not match, or an array could not be compacted
     */
     bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds);
 
@@ -589,6 +597,23 @@ public:
     */
     virtual AttributeMatrix::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief createSnapshot Creates a copy of the AttributeMatrix that shares structure with a
+     * previous snapshot. Any data array that has not changed since the previous snapshot was taken
+     * is reused instead of being copied. If nothing in the AttributeMatrix has changed then the
+     * previous snapshot itself is returned. Nodes returned from this method must be treated as read only.
+     * @param previous The snapshot of this AttributeMatrix taken earlier. May be nullptr.
+     * @return
+     */
+    AttributeMatrix::Pointer createSnapshot(const AttributeMatrix::Pointer& previous);
+
+    /**
+     * @brief shallowCopy Creates a new AttributeMatrix with the same name, type and tuple dimensions
+     * that holds the same data array instances as this AttributeMatrix.
+     * @return
+     */
+    AttributeMatrix::Pointer shallowCopy();
+
     /**
      * @brief writeAttributeArraysToHDF5
      * @param parentId
@@ -610,9 +635,13 @@ public:
      * @param amGid
      * @param preflight
      * @param attrMatProxy
+     * @param tupleOffset Optional start of the tuple subregion to read (XYZ order). The tuple
+     * dimensions of this AttributeMatrix must already be the extent of that subregion.
+     * @param tupleCount Extent of the tuple subregion to read (XYZ order)
      * @return
      */
-    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
+    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                            const QVector<size_t>& tupleCount = QVector<size_t>());
 
     /**
      * @brief generateXdmfText
@@ -676,6 +705,7 @@ public:
   private:
     QVector<size_t> m_TupleDims;
     QMap<QString, IDataArray::Pointer> m_AttributeArrays;
+    uint64_t m_Revision = 0;
 
     AttributeMatrix(const AttributeMatrix&);
     void operator =(const AttributeMatrix&);
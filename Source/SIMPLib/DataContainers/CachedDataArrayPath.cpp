@@ -0,0 +1,148 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CachedDataArrayPath.h"
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CachedDataArrayPath::CachedDataArrayPath() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CachedDataArrayPath::CachedDataArrayPath(const DataArrayPath& path)
+: m_Path(path)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CachedDataArrayPath::~CachedDataArrayPath() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CachedDataArrayPath::setPath(const DataArrayPath& path)
+{
+  m_Path = path;
+  invalidate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const DataArrayPath& CachedDataArrayPath::getPath() const
+{
+  return m_Path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CachedDataArrayPath::invalidate()
+{
+  m_DataContainerArray.reset();
+  m_DataContainerResolved = false;
+  m_AttributeMatrixResolved = false;
+  m_DataArrayResolved = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer CachedDataArrayPath::getDataContainer(const DataContainerArray::Pointer& dca)
+{
+  if(nullptr == dca.get())
+  {
+    return DataContainer::NullPointer();
+  }
+  if(!m_DataContainerResolved || m_DataContainerArray.lock() != dca || m_DataContainerArrayRevision != dca->getRevision() || m_NameRevision != DataContainer::GetNameRevision())
+  {
+    m_DataContainerArray = dca;
+    m_DataContainerArrayRevision = dca->getRevision();
+    m_NameRevision = DataContainer::GetNameRevision();
+    m_DataContainer = dca->getDataContainer(m_Path.getDataContainerName());
+    m_DataContainerResolved = true;
+    m_AttributeMatrixResolved = false;
+    m_DataArrayResolved = false;
+  }
+  return m_DataContainer.lock();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer CachedDataArrayPath::getAttributeMatrix(const DataContainerArray::Pointer& dca)
+{
+  DataContainer::Pointer dc = getDataContainer(dca);
+  if(nullptr == dc.get())
+  {
+    return AttributeMatrix::NullPointer();
+  }
+  if(!m_AttributeMatrixResolved || m_DataContainerRevision != dc->getRevision())
+  {
+    m_DataContainerRevision = dc->getRevision();
+    m_AttributeMatrix = dc->getAttributeMatrix(m_Path.getAttributeMatrixName());
+    m_AttributeMatrixResolved = true;
+    m_DataArrayResolved = false;
+  }
+  return m_AttributeMatrix.lock();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CachedDataArrayPath::getDataArray(const DataContainerArray::Pointer& dca)
+{
+  AttributeMatrix::Pointer am = getAttributeMatrix(dca);
+  if(nullptr == am.get())
+  {
+    return IDataArray::NullPointer();
+  }
+  if(!m_DataArrayResolved || m_AttributeMatrixRevision != am->getRevision())
+  {
+    m_AttributeMatrixRevision = am->getRevision();
+    m_DataArray = am->getAttributeArray(m_Path.getDataArrayName());
+    m_DataArrayResolved = true;
+  }
+  return m_DataArray.lock();
+}
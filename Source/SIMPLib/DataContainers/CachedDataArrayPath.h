@@ -0,0 +1,130 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+class DataContainer;
+class DataContainerArray;
+class AttributeMatrix;
+class IDataArray;
+
+/**
+ * @brief The CachedDataArrayPath class resolves a DataArrayPath against a DataContainerArray and
+ * remembers the DataContainer, AttributeMatrix and array it found. Later calls with the same
+ * DataContainerArray return the remembered objects without any name lookups until a DataContainer
+ * is added, removed or renamed, or an AttributeMatrix or array along the path is added, removed or
+ * renamed. Missing objects are remembered as well. Only weak references are held so a cached path
+ * never keeps data alive.
+ */
+class SIMPLib_EXPORT CachedDataArrayPath
+{
+public:
+  CachedDataArrayPath();
+  explicit CachedDataArrayPath(const DataArrayPath& path);
+  ~CachedDataArrayPath();
+
+  CachedDataArrayPath(const CachedDataArrayPath&) = default;
+  CachedDataArrayPath& operator=(const CachedDataArrayPath&) = default;
+
+  /**
+   * @brief Sets the path to resolve and forgets anything resolved for the previous path
+   * @param path
+   */
+  void setPath(const DataArrayPath& path);
+
+  /**
+   * @brief Returns the path that is resolved
+   * @return
+   */
+  const DataArrayPath& getPath() const;
+
+  /**
+   * @brief Forgets the resolved objects so the next call looks them up again
+   */
+  void invalidate();
+
+  /**
+   * @brief Returns the DataContainer named by the path or a null pointer
+   * @param dca
+   * @return
+   */
+  std::shared_ptr<DataContainer> getDataContainer(const DataContainerArrayShPtr& dca);
+
+  /**
+   * @brief Returns the AttributeMatrix named by the path or a null pointer
+   * @param dca
+   * @return
+   */
+  std::shared_ptr<AttributeMatrix> getAttributeMatrix(const DataContainerArrayShPtr& dca);
+
+  /**
+   * @brief Returns the array named by the path or a null pointer
+   * @param dca
+   * @return
+   */
+  std::shared_ptr<IDataArray> getDataArray(const DataContainerArrayShPtr& dca);
+
+  /**
+   * @brief Returns the array named by the path if it is of type ArrayType, otherwise a null pointer
+   * @param dca
+   * @return
+   */
+  template <typename ArrayType> typename ArrayType::Pointer getDataArrayAs(const DataContainerArrayShPtr& dca)
+  {
+    return std::dynamic_pointer_cast<ArrayType>(getDataArray(dca));
+  }
+
+private:
+  DataArrayPath m_Path;
+
+  std::weak_ptr<DataContainerArray> m_DataContainerArray;
+  uint64_t m_DataContainerArrayRevision = 0;
+  uint64_t m_NameRevision = 0;
+  bool m_DataContainerResolved = false;
+  std::weak_ptr<DataContainer> m_DataContainer;
+
+  uint64_t m_DataContainerRevision = 0;
+  bool m_AttributeMatrixResolved = false;
+  std::weak_ptr<AttributeMatrix> m_AttributeMatrix;
+
+  uint64_t m_AttributeMatrixRevision = 0;
+  bool m_DataArrayResolved = false;
+  std::weak_ptr<IDataArray> m_DataArray;
+};
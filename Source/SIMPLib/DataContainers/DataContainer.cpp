@@ -35,6 +35,9 @@
 
 #include "DataContainer.h"
 
+#include <atomic>
+#include <mutex>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
@@ -53,9 +56,15 @@
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 
+namespace
+{
+std::atomic<uint64_t> s_NameRevision(0);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -141,6 +150,10 @@ void DataContainer::ReadDataContainerStructure(hid_t dcArrayGroupId, DataContain
 // -----------------------------------------------------------------------------
 void DataContainer::setName(const QString& name)
 {
+  if(m_Name != name)
+  {
+    ++s_NameRevision;
+  }
   m_Name = name;
 }
 
@@ -152,6 +165,22 @@ QString DataContainer::getName()
   return m_Name;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataContainer::GetNameRevision()
+{
+  return s_NameRevision;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataContainer::getRevision() const
+{
+  return m_Revision;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -173,6 +202,8 @@ IGeometry::Pointer DataContainer::getGeometry()
 // -----------------------------------------------------------------------------
 DataContainer::AttributeMatrixMap_t& DataContainer::getAttributeMatrices()
 {
+  // The caller may change the map through the reference
+  m_Revision++;
   return m_AttributeMatrices;
 }
 
@@ -208,6 +239,7 @@ void DataContainer::addAttributeMatrix(const QString& name, AttributeMatrix::Poi
     data->setName(name);
   }
   m_AttributeMatrices[name] = data;
+  m_Revision++;
 }
 
 // -----------------------------------------------------------------------------
@@ -252,6 +284,7 @@ AttributeMatrix::Pointer DataContainer::removeAttributeMatrix(const QString& nam
   }
   AttributeMatrix::Pointer p = it.value();
   m_AttributeMatrices.erase(it);
+  m_Revision++;
   return p;
 }
 
@@ -294,6 +327,7 @@ bool DataContainer::renameAttributeMatrix(const QString& oldname, const QString&
 void DataContainer::clearAttributeMatrices()
 {
   m_AttributeMatrices.clear();
+  m_Revision++;
 }
 
 // -----------------------------------------------------------------------------
@@ -333,7 +367,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
     {
       return err;
     }
-    attributeMatrixId = H5Gopen(parentId, iter.key().toLatin1().data(), H5P_DEFAULT);
+    attributeMatrixId = QH5Utilities::openHDF5Object(parentId, iter.key());
     H5ScopedGroupSentinel gSentinel(&attributeMatrixId, false);
 
     AttributeMatrix::EnumType attrMatType = static_cast<AttributeMatrix::EnumType>(attrMat->getType());
@@ -362,12 +396,15 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
 // -----------------------------------------------------------------------------
 int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy)
 {
+  // The DataContainer group is closed on every way out of this function
+  H5ScopedGroupSentinel sentinel(&dcGid, false);
   int err = 0;
   QVector<size_t> tDims;
 
   QMap<QString, AttributeMatrixProxy> attrMatsToRead = dcProxy.attributeMatricies;
   AttributeMatrix::Type amType = AttributeMatrix::Type::Unknown;
   QString amName;
+  bool isImageGeom = (nullptr != m_Geometry.get() && m_Geometry->getGeometryType() == IGeometry::Type::Image);
   for(QMap<QString, AttributeMatrixProxy>::iterator iter = attrMatsToRead.begin(); iter != attrMatsToRead.end(); ++iter)
   {
     if(iter.value().flag == Qt::Unchecked)
@@ -389,6 +426,26 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
       return -1;
     }
 
+    // The tuple subregion applies to the cells of an Image Geometry and to Generic
+    // AttributeMatrices whose tuple dimensions have the same rank as the subregion
+    QVector<size_t> tupleOffset;
+    QVector<size_t> tupleCount;
+    AttributeMatrix::Type fileAmType = static_cast<AttributeMatrix::Type>(amTypeTmp);
+    if(dcProxy.hasTupleSubregion() && tDims.size() == dcProxy.tupleOffset.size() &&
+       (fileAmType == AttributeMatrix::Type::Generic || (fileAmType == AttributeMatrix::Type::Cell && isImageGeom)))
+    {
+      for(int i = 0; i < tDims.size(); i++)
+      {
+        if(dcProxy.tupleCount[i] == 0 || dcProxy.tupleOffset[i] + dcProxy.tupleCount[i] > tDims[i])
+        {
+          return -1;
+        }
+      }
+      tupleOffset = dcProxy.tupleOffset;
+      tupleCount = dcProxy.tupleCount;
+      tDims = tupleCount;
+    }
+
     hid_t amGid = H5Gopen(dcGid, amName.toLatin1().data(), H5P_DEFAULT);
     if(amGid < 0)
     {
@@ -403,17 +460,14 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
     }
 
     AttributeMatrixProxy amProxy = iter.value();
-    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy, tupleOffset, tupleCount);
     if(err < 0)
     {
-      err |= H5Gclose(dcGid);
       //      setErrorCondition(err);
       return -1;
     }
   }
 
-  err |= H5Gclose(dcGid);
-
   return err;
 }
 
@@ -440,6 +494,33 @@ DataContainer::Pointer DataContainer::deepCopy(bool forceNoAllocate)
   return dcCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainer::createSnapshot(const DataContainer::Pointer& previous)
+{
+  DataContainer::Pointer dcCopy = DataContainer::New(getName());
+
+  if(m_Geometry.get() != nullptr)
+  {
+    IGeometry::Pointer geomCopy = m_Geometry->deepCopy(false);
+    dcCopy->setGeometry(geomCopy);
+  }
+
+  for(AttributeMatrixMap_t::iterator iter = m_AttributeMatrices.begin(); iter != m_AttributeMatrices.end(); ++iter)
+  {
+    AttributeMatrix::Pointer prevAttrMat = (nullptr == previous.get()) ? AttributeMatrix::NullPointer() : previous->m_AttributeMatrices.value(iter.key());
+    AttributeMatrix::Pointer attrMat = (*iter)->createSnapshot(prevAttrMat);
+    if(nullptr == attrMat.get())
+    {
+      return DataContainer::NullPointer();
+    }
+    dcCopy->m_AttributeMatrices.insert(iter.key(), attrMat);
+  }
+
+  return dcCopy;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -452,7 +533,7 @@ int DataContainer::writeMeshToHDF5(hid_t dcGid, bool writeXdmf)
   {
     return err;
   }
-  geometryId = H5Gopen(dcGid, SIMPL::Geometry::Geometry.toLatin1().data(), H5P_DEFAULT);
+  geometryId = QH5Utilities::openHDF5Object(dcGid, SIMPL::Geometry::Geometry);
   if(geometryId < 0)
   {
     return -1;
@@ -499,6 +580,8 @@ int DataContainer::writeMeshToHDF5(hid_t dcGid, bool writeXdmf)
     {
       return err;
     }
+    // The geometries make raw HDF5 calls and may run on the HDF5 I/O thread
+    std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
     err = m_Geometry->IGeometry::writeGeometryToHDF5(geometryId, writeXdmf);
     if(err < 0)
     {
@@ -811,6 +894,40 @@ int DataContainer::readMeshDataFromHDF5(hid_t dcGid, bool preflight)
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainer::cropGeometryToTupleSubregion(const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(m_Geometry);
+  if(nullptr == image.get())
+  {
+    return 0;
+  }
+  if(tupleOffset.size() != 3 || tupleCount.size() != 3)
+  {
+    return -1;
+  }
+
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+  image->getResolution(res);
+  image->getOrigin(origin);
+  for(int i = 0; i < 3; i++)
+  {
+    if(tupleCount[i] == 0 || tupleOffset[i] + tupleCount[i] > dims[i])
+    {
+      return -1;
+    }
+    origin[i] = origin[i] + static_cast<float>(tupleOffset[i]) * res[i];
+  }
+  image->setDimensions(tupleCount[0], tupleCount[1], tupleCount[2]);
+  image->setOrigin(origin);
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -147,6 +147,20 @@ public:
   */
   virtual QString getName();
 
+  /**
+   * @brief Returns a counter that changes every time any DataContainer is given a different name.
+   * DataContainerArray uses it to notice renames that bypass it.
+   * @return
+   */
+  static uint64_t GetNameRevision();
+
+  /**
+   * @brief Returns a counter that changes every time an AttributeMatrix is added, removed or
+   * renamed, or the AttributeMatrix map is handed out for modification
+   * @return
+   */
+  uint64_t getRevision() const;
+
   /**
    * @brief Sets the geometry of the data container
    * @param geometry
@@ -348,6 +362,15 @@ public:
      */
     virtual DataContainer::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief createSnapshot Creates a copy of this DataContainer whose AttributeMatrices share
+     * structure with the matching AttributeMatrices of a previous snapshot.
+     * @see AttributeMatrix::createSnapshot
+     * @param previous The snapshot of this DataContainer taken earlier. May be nullptr.
+     * @return
+     */
+    DataContainer::Pointer createSnapshot(const DataContainer::Pointer& previous);
+
     /**
      * @brief writeMeshToHDF5
      * @param dcGid
@@ -371,6 +394,16 @@ public:
      */
     virtual int readMeshDataFromHDF5(hid_t dcGid, bool preflight);
 
+    /**
+     * @brief Restricts an Image Geometry that was just read from a file to a sub box of its
+     * cells. The dimensions become tupleCount and the origin moves to the first cell of the
+     * sub box. Other geometries are left untouched.
+     * @param tupleOffset The first cell of the sub box (XYZ order)
+     * @param tupleCount The number of cells in the sub box (XYZ order)
+     * @return Negative value if the sub box does not fit the Image Geometry
+     */
+    virtual int cropGeometryToTupleSubregion(const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount);
+
   protected:
 
     virtual void writeXdmfFooter(QTextStream& xdmf);
@@ -383,6 +416,7 @@ public:
     AttributeMatrixMap_t   m_AttributeMatrices;
     IGeometry::Pointer m_Geometry;
     QString m_Name;
+    uint64_t m_Revision = 0;
 
     DataContainer(const DataContainer&) = delete;  // Copy Constructor Not Implemented
     void operator=(const DataContainer&) = delete; // Move assignment Not Implemented
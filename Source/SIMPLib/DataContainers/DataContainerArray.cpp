@@ -34,6 +34,10 @@
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DataContainerArray.h"
 
+#include <mutex>
+
+#include "H5Support/H5Lite.h"
+
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 
@@ -56,6 +60,11 @@ DataContainerArray::~DataContainerArray() = default;
 void DataContainerArray::addDataContainer(DataContainer::Pointer f)
 {
   m_Array.push_back(f);
+  m_Revision++;
+  if(m_NameIndexValid && nullptr != f.get() && !m_NameIndex.contains(f->getName()))
+  {
+    m_NameIndex.insert(f->getName(), f);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +81,9 @@ int DataContainerArray::getNumDataContainers()
 void DataContainerArray::clearDataContainers()
 {
   m_Array.clear();
+  m_NameIndex.clear();
+  m_NameIndexValid = true;
+  m_Revision++;
 }
 
 #if 0
@@ -125,15 +137,13 @@ bool DataContainerArray::empty()
 DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& name)
 {
   removeDataContainerFromBundles(name);
-  DataContainer::Pointer f = DataContainer::NullPointer();
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+  DataContainer::Pointer f = findDataContainer(name);
+  if(nullptr != f.get())
   {
-    if((*it)->getName().compare(name) == 0)
-    {
-      f = *it;
-      m_Array.erase(it);
-      return f;
-    }
+    m_Array.removeOne(f);
+    m_Revision++;
+    // Another DataContainer with the same name may now be the first one
+    m_NameIndexValid = false;
   }
 
   // DO NOT return a NullPointer for any reason other than "DataContainer was not found"
@@ -145,41 +155,22 @@ DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& na
 // -----------------------------------------------------------------------------
 bool DataContainerArray::renameDataContainer(const QString& oldName, const QString& newName)
 {
-  DataContainer::Pointer dc = DataContainer::NullPointer();
-
-  // Make sure we do not already have a DataContainer with the newname
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+  // Make sure we do not already have a DataContainer with the newname. If we do we do NOT want
+  // to over write it so just bail out now
+  if(nullptr != findDataContainer(newName).get())
   {
-    if((*it)->getName().compare(newName) == 0)
-    {
-      dc = *it;
-      break;
-    }
+    return false;
   }
 
-  if(nullptr == dc)
-  {
-    // We did not find any data container that matches the new name so we can rename if we find one that matches
-    // the 'oldname' argument
-    // Now find the data container we want to rename
-    for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-    {
-      if((*it)->getName().compare(oldName) == 0)
-      {
-        // we have an existing DataContainer that matches our "oldname" that we want to rename so all is good.
-        dc = *it;
-        dc->setName(newName);
-        return true;
-      }
-    }
-  }
-  else if(nullptr != dc)
+  // Now find the data container we want to rename. Renaming it changes the DataContainer name
+  // revision, which makes the next lookup rebuild the name index.
+  DataContainer::Pointer dc = findDataContainer(oldName);
+  if(nullptr == dc.get())
   {
-    // We found an existing Data Container with the 'newname' but we do NOT want to over write it so just bail out now
     return false;
   }
-
-  return false; // default (but we should just NEVER make it here)
+  dc->setName(newName);
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -187,17 +178,29 @@ bool DataContainerArray::renameDataContainer(const QString& oldName, const QStri
 // -----------------------------------------------------------------------------
 DataContainer::Pointer DataContainerArray::getDataContainer(const QString& name)
 {
-  DataContainer::Pointer f = DataContainer::NullPointer();
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+  return findDataContainer(name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainerArray::findDataContainer(const QString& name)
+{
+  if(!m_NameIndexValid || m_IndexedNameRevision != DataContainer::GetNameRevision())
   {
-    if((*it)->getName().compare(name) == 0)
+    m_IndexedNameRevision = DataContainer::GetNameRevision();
+    m_NameIndex.clear();
+    m_NameIndex.reserve(m_Array.size());
+    for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
     {
-      f = *it;
-      break;
+      if(nullptr != (*it).get() && !m_NameIndex.contains((*it)->getName()))
+      {
+        m_NameIndex.insert((*it)->getName(), *it);
+      }
     }
+    m_NameIndexValid = true;
   }
-
-  return f;
+  return m_NameIndex.value(name, DataContainer::NullPointer());
 }
 
 // -----------------------------------------------------------------------------
@@ -228,16 +231,7 @@ AttributeMatrix::Pointer DataContainerArray::getAttributeMatrix(const DataArrayP
 // -----------------------------------------------------------------------------
 void DataContainerArray::duplicateDataContainer(const QString& name, const QString& newName)
 {
-  DataContainer::Pointer f = DataContainer::NullPointer();
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-  {
-    if((*it)->getName().compare(name) == 0)
-    {
-      f = *it;
-      break;
-    }
-  }
-
+  DataContainer::Pointer f = findDataContainer(name);
   if(f == nullptr)
   {
     return;
@@ -266,9 +260,20 @@ QList<QString> DataContainerArray::getDataContainerNames()
 // -----------------------------------------------------------------------------
 QList<DataContainer::Pointer>& DataContainerArray::getDataContainers()
 {
+  // The caller may change the list through the reference
+  m_NameIndexValid = false;
+  m_Revision++;
   return m_Array;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataContainerArray::getRevision() const
+{
+  return m_Revision;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -313,6 +318,10 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
     DataContainer::Pointer dc = DataContainer::New(dcProxy.name);
     this->addDataContainer(dc);
 
+    // The DataContainer readers make raw HDF5 calls. Locking one DataContainer at a time lets
+    // other threads use HDF5 between them.
+    std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
+
     // Now open the DataContainer Group in the HDF5 file
     hid_t dcGid = H5Gopen(dcaGid, dcProxy.name.toLatin1().data(), H5P_DEFAULT);
     if(dcGid < 0)
@@ -335,6 +344,20 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
+    if(dcProxy.hasTupleSubregion())
+    {
+      err = this->getDataContainer(dcProxy.name)->cropGeometryToTupleSubregion(dcProxy.tupleOffset, dcProxy.tupleCount);
+      if(err < 0)
+      {
+        H5Gclose(dcGid);
+        if(nullptr != obs)
+        {
+          QString ss = QObject::tr("The tuple subregion requested for '%1' does not fit inside its Image Geometry").arg(dcProxy.name);
+          obs->notifyErrorMessage(getNameOfClass(), ss, -198745605);
+        }
+        return -198745605;
+      }
+    }
     err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
     if(err < 0)
     {
@@ -354,14 +377,7 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesDataContainerExist(const QString& name)
 {
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-  {
-    if((*it)->getName().compare(name) == 0)
-    {
-      return true;
-    }
-  }
-  return false;
+  return nullptr != findDataContainer(name).get();
 }
 
 // -----------------------------------------------------------------------------
@@ -369,12 +385,11 @@ bool DataContainerArray::doesDataContainerExist(const QString& name)
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path)
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
+  DataContainer::Pointer dc = getDataContainer(path);
+  if(nullptr == dc.get())
   {
     return false;
   }
-
-  DataContainer::Pointer dc = getDataContainer(path);
   return dc->doesAttributeMatrixExist(path.getAttributeMatrixName());
 }
 
@@ -383,16 +398,11 @@ bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path)
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeArrayExist(const DataArrayPath& path)
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
-  {
-    return false;
-  }
-  if(!doesAttributeMatrixExist(path))
+  AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
+  if(nullptr == attrMat.get())
   {
     return false;
   }
-  AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
-
   return attrMat->doesAttributeArrayExist(path.getDataArrayName());
 }
 
@@ -539,6 +549,31 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate)
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerArray::createSnapshot(const DataContainerArray::Pointer& previous)
+{
+  DataContainerArray::Pointer snapshot = DataContainerArray::New();
+  snapshot->m_IsSnapshot = true;
+  for(QList<DataContainer::Pointer>::iterator iter = m_Array.begin(); iter != m_Array.end(); ++iter)
+  {
+    DataContainer::Pointer prevDc = (nullptr == previous.get()) ? DataContainer::NullPointer() : previous->getDataContainer((*iter)->getName());
+    DataContainer::Pointer dcCopy = (*iter)->createSnapshot(prevDc);
+    snapshot->addDataContainer(dcCopy);
+  }
+
+  return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerArray::isSnapshot()
+{
+  return m_IsSnapshot;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -559,12 +594,28 @@ void DataContainerArray::renameDataArrayPaths(DataArrayPath::RenameContainer ren
       DataContainer::Pointer dc = getDataContainer(newPath);
       if(dc)
       {
+        // Snapshots share AttributeMatrices with other snapshots so copy the one being renamed
+        AttributeMatrix::Pointer am = dc->getAttributeMatrix(oldPath.getAttributeMatrixName());
+        if(m_IsSnapshot && am)
+        {
+          dc->addAttributeMatrix(am->getName(), am->shallowCopy());
+        }
         dc->renameAttributeMatrix(oldPath.getAttributeMatrixName(), newPath.getAttributeMatrixName());
       }
     }
     if(oldPath.getDataArrayName() != newPath.getDataArrayName())
     {
       AttributeMatrix::Pointer am = getAttributeMatrix(newPath);
+      if(am && m_IsSnapshot)
+      {
+        IDataArray::Pointer da = am->getAttributeArray(oldPath.getDataArrayName());
+        if(da)
+        {
+          am = am->shallowCopy();
+          am->addAttributeArray(da->getName(), da->deepCopy(false));
+          getDataContainer(newPath)->addAttributeMatrix(am->getName(), am);
+        }
+      }
       if(am)
       {
         am->renameAttributeArray(oldPath.getDataArrayName(), newPath.getDataArrayName());
@@ -40,6 +40,7 @@
 
 #include <QtCore/QObject> // for Q_OBJECT
 #include <QtCore/QString>
+#include <QtCore/QHash>
 #include <QtCore/QList>
 
 #include "SIMPLib/SIMPLib.h"
@@ -108,11 +109,19 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     virtual DataContainerShPtr getDataContainer(const QString& name);
 
     /**
-     * @brief getDataContainers
+     * @brief getDataContainers Returns the list itself so the caller may modify it. The name index is
+     * rebuilt on the next lookup.
      * @return
      */
     QList<DataContainerShPtr>& getDataContainers();
 
+    /**
+     * @brief Returns a counter that changes every time a DataContainer is added or removed, or the
+     * list is handed out for modification
+     * @return
+     */
+    uint64_t getRevision() const;
+
     /**
      * @brief Returns if a DataContainer with the give name is in the array
      * @param name The name of the DataContiner to find
@@ -735,12 +744,45 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
      */
     DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief createSnapshot Creates a copy of this DataContainerArray that shares every AttributeMatrix
+     * and DataArray that has not changed since the previous snapshot was taken. This is used by the
+     * FilterPipeline to store the state of the DataContainerArray after each filter is preflighted
+     * without rebuilding the entire structure for every filter. The nodes of the returned
+     * DataContainerArray are shared and must not be modified in place; renameDataArrayPaths() will
+     * copy any node that it needs to rename.
+     * @param previous The previous snapshot. May be nullptr in which case a full copy is made.
+     * @return
+     */
+    DataContainerArray::Pointer createSnapshot(const DataContainerArray::Pointer& previous);
+
+    /**
+     * @brief isSnapshot Returns true if this DataContainerArray was created by createSnapshot()
+     * @return
+     */
+    bool isSnapshot();
+
   protected:
     DataContainerArray();
 
   private:
     QList<DataContainerShPtr>  m_Array;
     QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
+    bool m_IsSnapshot = false;
+
+    // Maps each name to the first DataContainer in m_Array with that name
+    QHash<QString, DataContainerShPtr> m_NameIndex;
+    bool m_NameIndexValid = true;
+    uint64_t m_IndexedNameRevision = 0;
+    uint64_t m_Revision = 0;
+
+    /**
+     * @brief Returns the first DataContainer named name, rebuilding the name index first if the list
+     * or any DataContainer name changed without going through this class
+     * @param name
+     * @return
+     */
+    DataContainerShPtr findDataContainer(const QString& name);
 
     DataContainerArray(const DataContainerArray&) = delete; // Copy Constructor Not Implemented
     void operator=(const DataContainerArray&) = delete;     // Move assignment Not Implemented
@@ -62,6 +62,8 @@ DataContainerProxy::DataContainerProxy(const DataContainerProxy& amp)
   name = amp.name;
   dcType = amp.dcType;
   attributeMatricies = amp.attributeMatricies;
+  tupleOffset = amp.tupleOffset;
+  tupleCount = amp.tupleCount;
 }
 
 // -----------------------------------------------------------------------------
@@ -74,7 +76,15 @@ DataContainerProxy& DataContainerProxy::operator=(const DataContainerProxy& amp)
 // -----------------------------------------------------------------------------
 bool DataContainerProxy::operator==(const DataContainerProxy& amp) const
 {
-  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies;
+  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies && tupleOffset == amp.tupleOffset && tupleCount == amp.tupleCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerProxy::hasTupleSubregion() const
+{
+  return !tupleOffset.isEmpty() && tupleOffset.size() == tupleCount.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -108,6 +118,18 @@ void DataContainerProxy::writeJson(QJsonObject& json)
   json["Name"] = name;
   json["Type"] = static_cast<double>(dcType);
   json["Attribute Matricies"] = writeMap(attributeMatricies);
+  if(hasTupleSubregion())
+  {
+    QJsonArray offsetArray;
+    QJsonArray countArray;
+    for(int i = 0; i < tupleOffset.size(); i++)
+    {
+      offsetArray.push_back(static_cast<double>(tupleOffset[i]));
+      countArray.push_back(static_cast<double>(tupleCount[i]));
+    }
+    json["Tuple Offset"] = offsetArray;
+    json["Tuple Count"] = countArray;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -127,6 +149,21 @@ bool DataContainerProxy::readJson(QJsonObject& json)
       dcType = static_cast<unsigned int>(json["Type"].toDouble());
     }
     attributeMatricies = readMap(json["Attribute Matricies"].toArray());
+    tupleOffset.clear();
+    tupleCount.clear();
+    if(json["Tuple Offset"].isArray() && json["Tuple Count"].isArray())
+    {
+      QJsonArray offsetArray = json["Tuple Offset"].toArray();
+      QJsonArray countArray = json["Tuple Count"].toArray();
+      if(offsetArray.size() == countArray.size())
+      {
+        for(int i = 0; i < offsetArray.size(); i++)
+        {
+          tupleOffset.push_back(static_cast<size_t>(offsetArray[i].toDouble()));
+          tupleCount.push_back(static_cast<size_t>(countArray[i].toDouble()));
+        }
+      }
+    }
     return true;
   }
   return false;
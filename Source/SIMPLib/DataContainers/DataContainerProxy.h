@@ -39,6 +39,7 @@
 #include <QtCore/QMetaType>
 #include <QtCore/QString>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtCore/QJsonArray>
 
 #include "SIMPLib/SIMPLib.h"
@@ -143,12 +144,26 @@ class SIMPLib_EXPORT DataContainerProxy
      */
     void updatePath(DataArrayPath::RenameType renamePath);
 
+    /**
+     * @brief Returns true if only a subregion of the element tuples should be read
+     * for this DataContainer. See tupleOffset and tupleCount.
+     * @return
+     */
+    bool hasTupleSubregion() const;
+
     //----- Our variables, publicly available
     uint8_t flag;
     QString name;
     unsigned int dcType;
     QMap<QString, AttributeMatrixProxy> attributeMatricies;
 
+    // Optional subregion of the element tuples to read, in XYZ order. For an Image Geometry
+    // this is a sub box of the cells and the geometry's origin and dimensions are adjusted
+    // to match. A single entry is a tuple range for Generic AttributeMatrices. Empty
+    // vectors read every tuple.
+    QVector<size_t> tupleOffset;
+    QVector<size_t> tupleCount;
+
   private:
 
     /**
@@ -52,6 +52,7 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AttributeMatrix.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AttributeMatrixProxy.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CachedDataArrayPath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayPath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayProxy.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataContainer.h
@@ -62,6 +63,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AttributeMatrix.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AttributeMatrixProxy.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CachedDataArrayPath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayPath.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayProxy.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataContainer.cpp
@@ -0,0 +1,162 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/CachedDataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataContainerArrayTest
+{
+public:
+  DataContainerArrayTest() = default;
+  virtual ~DataContainerArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataContainerLookup()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    for(int i = 0; i < 500; i++)
+    {
+      dca->addDataContainer(DataContainer::New(QString("Slice %1").arg(i)));
+    }
+    DREAM3D_REQUIRE_EQUAL(dca->getNumDataContainers(), 500);
+    DREAM3D_REQUIRE_EQUAL(dca->getDataContainer("Slice 250")->getName(), QString("Slice 250"));
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Slice 500"), false);
+
+    // Renaming through the array and directly on the DataContainer
+    DREAM3D_REQUIRE_EQUAL(dca->renameDataContainer("Slice 1", "Slice 2"), false);
+    DREAM3D_REQUIRE_EQUAL(dca->renameDataContainer("Slice 1", "First"), true);
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Slice 1"), false);
+    DREAM3D_REQUIRE_VALID_POINTER(dca->getDataContainer("First").get());
+    dca->getDataContainer("Slice 3")->setName("Third");
+    DREAM3D_REQUIRE_NULL_POINTER(dca->getDataContainer("Slice 3").get());
+    DREAM3D_REQUIRE_VALID_POINTER(dca->getDataContainer("Third").get());
+
+    // The first DataContainer with a name wins, and the next one takes over once it is removed
+    DataContainer::Pointer duplicate = DataContainer::New("Slice 10");
+    dca->addDataContainer(duplicate);
+    DREAM3D_REQUIRE(dca->getDataContainer("Slice 10") != duplicate);
+    DREAM3D_REQUIRE(dca->removeDataContainer("Slice 10") != duplicate);
+    DREAM3D_REQUIRE(dca->getDataContainer("Slice 10") == duplicate);
+
+    // Changes made through the list reference are picked up
+    dca->getDataContainers().removeFirst();
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Slice 0"), false);
+    dca->getDataContainers().push_back(DataContainer::New("Appended"));
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Appended"), true);
+
+    dca->clearDataContainers();
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Slice 20"), false);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCachedDataArrayPath()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addDataContainer(dc);
+    QVector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = dc->createAndAddAttributeMatrix(tDims, "CellData", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(10, "Data", true);
+    am->addAttributeArray(data->getName(), data);
+
+    CachedDataArrayPath path(DataArrayPath("DataContainer", "CellData", "Data"));
+    DREAM3D_REQUIRE(path.getDataContainer(dca) == dc);
+    DREAM3D_REQUIRE(path.getAttributeMatrix(dca) == am);
+    DREAM3D_REQUIRE(path.getDataArray(dca) == data);
+    DREAM3D_REQUIRE(path.getDataArrayAs<FloatArrayType>(dca) == data);
+    DREAM3D_REQUIRE_NULL_POINTER(path.getDataArrayAs<Int32ArrayType>(dca).get());
+
+    // Replacing or removing the array is noticed
+    FloatArrayType::Pointer replacement = FloatArrayType::CreateArray(10, "Data", true);
+    am->addAttributeArray(replacement->getName(), replacement);
+    DREAM3D_REQUIRE(path.getDataArray(dca) == replacement);
+    am->removeAttributeArray("Data");
+    DREAM3D_REQUIRE_NULL_POINTER(path.getDataArray(dca).get());
+    am->addAttributeArray(data->getName(), data);
+    DREAM3D_REQUIRE(path.getDataArray(dca) == data);
+
+    // Renaming any level along the path is noticed
+    dc->renameAttributeMatrix("CellData", "Renamed");
+    DREAM3D_REQUIRE_NULL_POINTER(path.getAttributeMatrix(dca).get());
+    dc->renameAttributeMatrix("Renamed", "CellData");
+    DREAM3D_REQUIRE(path.getDataArray(dca) == data);
+    dca->renameDataContainer("DataContainer", "Other");
+    DREAM3D_REQUIRE_NULL_POINTER(path.getDataArray(dca).get());
+    dc->setName("DataContainer");
+    DREAM3D_REQUIRE(path.getDataArray(dca) == data);
+
+    // A different DataContainerArray, or removing the DataContainer, resolves again
+    DataContainerArray::Pointer copy = dca->deepCopy(false);
+    IDataArray::Pointer copiedData = path.getDataArray(copy);
+    DREAM3D_REQUIRE_VALID_POINTER(copiedData.get());
+    DREAM3D_REQUIRE(copiedData != data);
+    dca->removeDataContainer("DataContainer");
+    DREAM3D_REQUIRE_NULL_POINTER(path.getDataContainer(dca).get());
+
+    path.setPath(DataArrayPath("DataContainer", "CellData", "Missing"));
+    DREAM3D_REQUIRE_NULL_POINTER(path.getDataArray(copy).get());
+    DREAM3D_REQUIRE_VALID_POINTER(path.getAttributeMatrix(copy).get());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataContainerArrayTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestDataContainerLookup())
+    DREAM3D_REGISTER_TEST(TestCachedDataArrayPath())
+  }
+
+private:
+  DataContainerArrayTest(const DataContainerArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const DataContainerArrayTest&);         // Move assignment Not Implemented
+};
@@ -1,4 +1,5 @@
 set(TEST_${SUBDIR_NAME}_NAMES
+  DataContainerArrayTest
   DataContainerBundleTest
 )
 
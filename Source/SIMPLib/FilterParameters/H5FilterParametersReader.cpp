@@ -1142,6 +1142,14 @@ DataContainerArrayProxy H5FilterParametersReader::readDataContainerArrayProxy(co
     DataContainerProxy dcProxy;
     dcProxy.name = dcName;
     dcProxy.flag = Qt::Checked;
+    if(QH5Lite::findAttribute(dcGid, "TupleOffset") > 0)
+    {
+      if(QH5Lite::readVectorAttribute(dcaGid, dcName, "TupleOffset", dcProxy.tupleOffset) < 0 || QH5Lite::readVectorAttribute(dcaGid, dcName, "TupleCount", dcProxy.tupleCount) < 0)
+      {
+        dcProxy.tupleOffset.clear();
+        dcProxy.tupleCount.clear();
+      }
+    }
     // Loop over the attribute Matrices
     QList<QString> amNames;
     err = QH5Utilities::getGroupObjects(dcGid, H5Utilities::H5Support_GROUP, amNames);
@@ -749,6 +749,15 @@ int H5FilterParametersWriter::writeValue(const QString name, const DataContainer
     }
 
     H5Gclose(dcGid);
+
+    if(dcProxy.hasTupleSubregion())
+    {
+      QVector<size_t> tupleOffset = dcProxy.tupleOffset;
+      QVector<size_t> tupleCount = dcProxy.tupleCount;
+      hsize_t size = tupleOffset.size();
+      err = QH5Lite::writePointerAttribute(dcaGid, dcProxy.name, "TupleOffset", 1, &size, tupleOffset.data());
+      err = QH5Lite::writePointerAttribute(dcaGid, dcProxy.name, "TupleCount", 1, &size, tupleCount.data());
+    }
   }
 
   H5Gclose(dcaGid);
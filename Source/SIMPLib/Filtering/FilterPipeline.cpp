@@ -35,6 +35,14 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
@@ -521,11 +529,61 @@ int FilterPipeline::preflightPipeline()
   setErrorCondition(0);
   int preflightError = 0;
 
+  // Each filter keeps a snapshot of the DataContainerArray. Consecutive snapshots share every
+  // AttributeMatrix and DataArray that a filter did not touch.
+  DataContainerArray::Pointer snapshot = DataContainerArray::NullPointer();
+
   DataArrayPath::RenameContainer renamedPaths;
   DataArrayPath::RenameContainer filterRenamedPaths;
 
+  // Find the first filter that needs to be preflighted again. Every filter before it is unchanged
+  // since the last preflight, as is everything upstream of it, so its saved DataContainerArray is still valid.
+  QVector<QByteArray> signatures;
+  int resumeIndex = 0;
+  if(nullptr != m_PreflightCache.get())
+  {
+    signatures = createPreflightSignatures();
+    int count = std::min(m_Pipeline.size(), m_PreflightCache->size());
+    while(resumeIndex < count)
+    {
+      const PreflightCacheEntry& entry = m_PreflightCache->at(resumeIndex);
+      AbstractFilter::Pointer filter = m_Pipeline[resumeIndex];
+      if(entry.filter.lock() != filter || entry.signature != signatures[resumeIndex] || !entry.clean || entry.dataContainerArray != filter->getDataContainerArray())
+      {
+        break;
+      }
+      resumeIndex++;
+    }
+  }
+
+  for(int i = 0; i < resumeIndex; i++)
+  {
+    AbstractFilter::Pointer filter = m_Pipeline[i];
+    snapshot = filter->getDataContainerArray();
+    DataArrayPath::RenameContainer hardRenamePaths = filter->getRenamedPaths();
+    for(DataArrayPath::RenameType renameType : hardRenamePaths)
+    {
+      if(filter->getEnabled())
+      {
+        renamedPaths.push_back(renameType);
+        filterRenamedPaths.push_back(renameType);
+      }
+      else
+      {
+        DataArrayPath oldPath;
+        DataArrayPath newPath;
+        std::tie(oldPath, newPath) = renameType;
+        renamedPaths.push_back(DataArrayPath::RenameType(newPath, oldPath));
+      }
+    }
+  }
+  if(nullptr != snapshot.get())
+  {
+    dca = snapshot->deepCopy(false);
+  }
+
   // Start looping through each filter in the Pipeline and preflight everything
-  for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
+  for(FilterContainerType::iterator filter = m_Pipeline.begin() + resumeIndex; filter != m_Pipeline.end(); ++filter)
   {
     // Do not preflight disabled filters
     if((*filter)->getEnabled())
@@ -547,7 +605,8 @@ int FilterPipeline::preflightPipeline()
 
       (*filter)->setCancel(false); // Reset the cancel flag
       preflightError |= (*filter)->getErrorCondition();
-      (*filter)->setDataContainerArray(dca->deepCopy(false));
+      snapshot = dca->createSnapshot(snapshot);
+      (*filter)->setDataContainerArray(snapshot);
       std::list<DataArrayPath> currentCreatedPaths = (*filter)->getCreatedPaths();
 
       // Check if an existing renamed path was created by this filter
@@ -596,7 +655,8 @@ int FilterPipeline::preflightPipeline()
     else
     {
       // Some widgets require the updated path to be valid before it can be set in the widget
-      (*filter)->setDataContainerArray(dca->deepCopy(false));
+      snapshot = dca->createSnapshot(snapshot);
+      (*filter)->setDataContainerArray(snapshot);
       (*filter)->renameDataArrayPaths(renamedPaths);
 
       // Undo filter renaming
@@ -614,9 +674,79 @@ int FilterPipeline::preflightPipeline()
   }
   setCurrentFilter(AbstractFilter::NullPointer());
 
+  if(nullptr != m_PreflightCache.get())
+  {
+    // Preflighting may have renamed paths in the filter parameters so the signatures are computed again
+    signatures = createPreflightSignatures();
+    m_PreflightCache->resize(m_Pipeline.size());
+    for(int i = resumeIndex; i < m_Pipeline.size(); i++)
+    {
+      AbstractFilter::Pointer filter = m_Pipeline[i];
+      PreflightCacheEntry& entry = (*m_PreflightCache)[i];
+      entry.filter = filter;
+      entry.signature = signatures[i];
+      entry.dataContainerArray = filter->getDataContainerArray();
+      entry.clean = !filter->getEnabled() || (filter->getErrorCondition() >= 0 && filter->getWarningCondition() >= 0);
+    }
+  }
+
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QByteArray> FilterPipeline::createPreflightSignatures()
+{
+  QVector<QByteArray> signatures;
+  QByteArray upstream;
+  for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
+  {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(upstream);
+    hash.addData((*filter)->getNameOfClass().toUtf8());
+    hash.addData((*filter)->getEnabled() ? "1" : "0");
+    QJsonObject filterJson = (*filter)->toJson();
+    hash.addData(QJsonDocument(filterJson).toJson(QJsonDocument::Compact));
+    addInputFileState(filterJson, hash);
+    upstream = hash.result();
+    signatures.push_back(upstream);
+  }
+  return signatures;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::addInputFileState(const QJsonValue& value, QCryptographicHash& hash)
+{
+  if(value.isString())
+  {
+    QFileInfo fi(value.toString());
+    if(fi.isAbsolute() && fi.isFile())
+    {
+      hash.addData(QByteArray::number(fi.size()));
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+    }
+  }
+  else if(value.isArray())
+  {
+    QJsonArray array = value.toArray();
+    for(const QJsonValue& element : array)
+    {
+      addInputFileState(element, hash);
+    }
+  }
+  else if(value.isObject())
+  {
+    QJsonObject object = value.toObject();
+    for(QJsonObject::const_iterator iter = object.constBegin(); iter != object.constEnd(); ++iter)
+    {
+      addInputFileState(iter.value(), hash);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
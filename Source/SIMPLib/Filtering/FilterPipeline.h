@@ -47,6 +47,7 @@
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
+class QCryptographicHash;
 
 /**
  * @class FilterPipeline FilterPipeline.h DREAM3DLib/Common/FilterPipeline.h
@@ -87,9 +88,35 @@ public:
 
   typedef QList<AbstractFilter::Pointer> FilterContainerType;
 
+  /**
+   * @brief The PreflightCacheEntry struct records the result of preflighting a single filter. The
+   * signature is a hash of the filter's parameters, and of the size and modification time of every
+   * file those parameters name, combined with the signature of every filter upstream of it so that
+   * any change upstream also invalidates the entry.
+   */
+  struct PreflightCacheEntry
+  {
+    AbstractFilter::WeakPointer filter;
+    QByteArray signature;
+    DataContainerArray::Pointer dataContainerArray;
+    bool clean = false;
+  };
+
+  using PreflightCache = QVector<PreflightCacheEntry>;
+  using PreflightCacheShPtr = std::shared_ptr<PreflightCache>;
+
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief When a PreflightCache is set, preflightPipeline() skips every leading filter whose
+   * signature matches the cache and that preflighted without errors or warnings the last time,
+   * resuming from the DataContainerArray that the last of those filters produced. The cache
+   * is updated at the end of each preflight. A filter that reads a file is preflighted again when
+   * the size or modification time of that file changes. Clear the cache to force a full preflight.
+   */
+  SIMPL_INSTANCE_PROPERTY(PreflightCacheShPtr, PreflightCache)
+
   /**
    * @brief Cancel the operation
    */
@@ -188,6 +215,20 @@ protected:
 
   void updatePrevNextFilters();
 
+  /**
+   * @brief Computes the preflight signature of every filter in the pipeline
+   * @return
+   */
+  QVector<QByteArray> createPreflightSignatures();
+
+  /**
+   * @brief Adds the size and modification time of every existing file named by an absolute path
+   * anywhere in value to the hash
+   * @param value
+   * @param hash
+   */
+  void addInputFileState(const QJsonValue& value, QCryptographicHash& hash);
+
 signals:
   void pipelineGeneratedMessage(const PipelineMessage& message);
 
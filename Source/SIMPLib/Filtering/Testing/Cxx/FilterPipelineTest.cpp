@@ -42,6 +42,10 @@
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/RawBinaryReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
@@ -154,6 +158,131 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflight()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->setPreflightCache(std::make_shared<FilterPipeline::PreflightCache>());
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 10.0))));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    pipeline->pushBack(createAm);
+
+    CreateDataArray::Pointer createDa = CreateDataArray::New();
+    createDa->setNewArray(DataArrayPath("DataContainer", "AttributeMatrix", "Array"));
+    createDa->setNumberOfComponents(1);
+    createDa->setInitializationValue("1");
+    pipeline->pushBack(createDa);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DataContainerArray::Pointer dcDca = createDc->getDataContainerArray();
+    DataContainerArray::Pointer amDca = createAm->getDataContainerArray();
+    DataContainerArray::Pointer daDca = createDa->getDataContainerArray();
+
+    // Nothing changed so no filter should have been preflighted again
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(createDc->getDataContainerArray() == dcDca)
+    DREAM3D_REQUIRE(createAm->getDataContainerArray() == amDca)
+    DREAM3D_REQUIRE(createDa->getDataContainerArray() == daDca)
+
+    // Changing the last filter only preflights the last filter
+    createDa->setNewArray(DataArrayPath("DataContainer", "AttributeMatrix", "Renamed"));
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(createDc->getDataContainerArray() == dcDca)
+    DREAM3D_REQUIRE(createAm->getDataContainerArray() == amDca)
+    DREAM3D_REQUIRE(createDa->getDataContainerArray() != daDca)
+    DREAM3D_REQUIRE_EQUAL(createDa->getDataContainerArray()->doesAttributeArrayExist(DataArrayPath("DataContainer", "AttributeMatrix", "Renamed")), true)
+    DREAM3D_REQUIRE_EQUAL(createDa->getDataContainerArray()->doesAttributeArrayExist(DataArrayPath("DataContainer", "AttributeMatrix", "Array")), false)
+
+    // Changing the first filter invalidates everything downstream of it
+    amDca = createAm->getDataContainerArray();
+    createDc->setDataContainerName("DataContainer2");
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(createDc->getDataContainerArray() != dcDca)
+    DREAM3D_REQUIRE(createAm->getDataContainerArray() != amDca)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteRawFile(const QString& filePath, int numValues)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::WriteOnly), true)
+    std::vector<float> values(static_cast<size_t>(numValues), 1.0f);
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<qint64>(values.size() * sizeof(float)));
+    file.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIncrementalPreflightInputFile()
+  {
+    QString filePath = UnitTest::TestTempDir + QString("/FilterPipelineTest.raw");
+    WriteRawFile(filePath, 10);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    FilterPipeline::PreflightCacheShPtr cache = std::make_shared<FilterPipeline::PreflightCache>();
+    pipeline->setPreflightCache(cache);
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+    createAm->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 10.0))));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    pipeline->pushBack(createAm);
+
+    RawBinaryReader::Pointer reader = RawBinaryReader::New();
+    reader->setInputFile(filePath);
+    reader->setScalarType(SIMPL::NumericTypes::Type::Float);
+    reader->setNumberOfComponents(1);
+    reader->setCreatedAttributeArrayPath(DataArrayPath("DataContainer", "AttributeMatrix", "Array"));
+    pipeline->pushBack(reader);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DataContainerArray::Pointer amDca = createAm->getDataContainerArray();
+    DataContainerArray::Pointer readerDca = reader->getDataContainerArray();
+
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(reader->getDataContainerArray() == readerDca)
+
+    // A different input file is a different preflight even though no parameter changed
+    WriteRawFile(filePath, 20);
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(createAm->getDataContainerArray() == amDca)
+    DREAM3D_REQUIRE(reader->getDataContainerArray() != readerDca)
+
+    // Clearing the cache preflights every filter again
+    WriteRawFile(filePath, 10);
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    readerDca = reader->getDataContainerArray();
+    cache->clear();
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(createAm->getDataContainerArray() != amDca)
+    DREAM3D_REQUIRE(reader->getDataContainerArray() != readerDca)
+
+    QFile::remove(filePath);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -168,6 +297,8 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflight());
+    DREAM3D_REGISTER_TEST(TestIncrementalPreflightInputFile());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
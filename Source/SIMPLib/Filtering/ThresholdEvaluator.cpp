@@ -0,0 +1,411 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "ThresholdEvaluator.h"
+
+#include <algorithm>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * @brief The Node class is one entry of the comparison tree
+ */
+class ThresholdEvaluator::Node
+{
+public:
+  explicit Node(int unionOperator)
+  : m_UnionOperator(unionOperator)
+  {
+  }
+  virtual ~Node() = default;
+
+  /**
+   * @brief Evaluates the tuples [start, start + count) into out. The scratch memory holds
+   * getScratchDepth() blocks that the nested entries may use.
+   */
+  virtual void evaluate(size_t start, size_t count, bool* out, bool* scratch) const = 0;
+
+  /**
+   * @brief Returns the number of scratch blocks that evaluate() needs
+   */
+  virtual size_t getScratchDepth() const
+  {
+    return 0;
+  }
+
+  int getUnionOperator() const
+  {
+    return m_UnionOperator;
+  }
+
+private:
+  int m_UnionOperator;
+};
+
+namespace
+{
+// Tuples per block. The block buffers of a few nested sets stay well inside the L1/L2 cache
+constexpr size_t k_BlockSize = 4096;
+
+/**
+ * @brief The ComparisonNode class compares a scalar array against a value. The comparison is
+ * done in the type of the array, as in ThresholdFilterHelper.
+ */
+template <typename T> class ComparisonNode : public ThresholdEvaluator::Node
+{
+public:
+  ComparisonNode(typename DataArray<T>::Pointer input, int compOperator, double compValue, int unionOperator)
+  : Node(unionOperator)
+  , m_Input(input)
+  , m_CompOperator(compOperator)
+  , m_CompValue(static_cast<T>(compValue))
+  {
+  }
+  ~ComparisonNode() override = default;
+
+  void evaluate(size_t start, size_t count, bool* out, bool* SIMPL_NOT_USED(scratch)) const override
+  {
+    const T* data = m_Input->getPointer(start);
+    const T value = m_CompValue;
+    // The switch is outside of the loops so that each loop is a plain compare that vectorizes
+    switch(m_CompOperator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] = (data[i] < value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] = (data[i] > value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] = (data[i] == value);
+      }
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] = (data[i] != value);
+      }
+      break;
+    default:
+      std::fill(out, out + count, false);
+      break;
+    }
+  }
+
+private:
+  typename DataArray<T>::Pointer m_Input;
+  int m_CompOperator;
+  T m_CompValue;
+};
+
+/**
+ * @brief The SetNode class merges the results of its entries. The first entry initializes the
+ * result and every later entry is merged with its union operator.
+ */
+class SetNode : public ThresholdEvaluator::Node
+{
+public:
+  SetNode(int unionOperator, bool invert)
+  : Node(unionOperator)
+  , m_Invert(invert)
+  {
+  }
+  ~SetNode() override = default;
+
+  void addEntry(const std::shared_ptr<ThresholdEvaluator::Node>& entry)
+  {
+    m_Entries.push_back(entry);
+  }
+
+  void setInvert(bool invert)
+  {
+    m_Invert = invert;
+  }
+
+  void evaluate(size_t start, size_t count, bool* out, bool* scratch) const override
+  {
+    if(m_Entries.empty())
+    {
+      std::fill(out, out + count, false);
+    }
+    else
+    {
+      m_Entries[0]->evaluate(start, count, out, scratch);
+      for(size_t e = 1; e < m_Entries.size(); e++)
+      {
+        const ThresholdEvaluator::Node& entry = *m_Entries[e];
+        entry.evaluate(start, count, scratch, scratch + k_BlockSize);
+        if(entry.getUnionOperator() == SIMPL::Union::Operator_Or)
+        {
+          for(size_t i = 0; i < count; i++)
+          {
+            out[i] = out[i] | scratch[i];
+          }
+        }
+        else
+        {
+          for(size_t i = 0; i < count; i++)
+          {
+            out[i] = out[i] & scratch[i];
+          }
+        }
+      }
+    }
+
+    if(m_Invert)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        out[i] = !out[i];
+      }
+    }
+  }
+
+  size_t getScratchDepth() const override
+  {
+    // The first entry writes into the output and may use every scratch block. The others write
+    // into the first scratch block and nest below it.
+    size_t depth = 0;
+    for(size_t e = 0; e < m_Entries.size(); e++)
+    {
+      size_t entryDepth = m_Entries[e]->getScratchDepth() + (e > 0 ? 1 : 0);
+      depth = std::max(depth, entryDepth);
+    }
+    return depth;
+  }
+
+private:
+  std::vector<std::shared_ptr<ThresholdEvaluator::Node>> m_Entries;
+  bool m_Invert;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> std::shared_ptr<ThresholdEvaluator::Node> CreateComparisonNode(const IDataArray::Pointer& input, int compOperator, double compValue, int unionOperator)
+{
+  typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(input);
+  if(nullptr == array)
+  {
+    return std::shared_ptr<ThresholdEvaluator::Node>();
+  }
+  return std::make_shared<ComparisonNode<T>>(array, compOperator, compValue, unionOperator);
+}
+
+/**
+ * @brief The EvaluateThresholdImpl class evaluates a range of blocks of the comparison tree
+ */
+class EvaluateThresholdImpl
+{
+public:
+  EvaluateThresholdImpl(const ThresholdEvaluator::Node* root, bool* output, size_t numTuples)
+  : m_Root(root)
+  , m_Output(output)
+  , m_NumTuples(numTuples)
+  {
+  }
+  virtual ~EvaluateThresholdImpl() = default;
+
+  void evaluate(size_t blockStart, size_t blockEnd) const
+  {
+    std::unique_ptr<bool[]> scratch(new bool[m_Root->getScratchDepth() * k_BlockSize + 1]);
+    for(size_t b = blockStart; b < blockEnd; b++)
+    {
+      size_t start = b * k_BlockSize;
+      size_t count = std::min(k_BlockSize, m_NumTuples - start);
+      m_Root->evaluate(start, count, m_Output + start, scratch.get());
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    evaluate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ThresholdEvaluator::Node* m_Root;
+  bool* m_Output;
+  size_t m_NumTuples;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::ThresholdEvaluator()
+: m_Root(new SetNode(SIMPL::Union::Operator_And, false))
+{
+  m_OpenSets.push_back(m_Root.get());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::~ThresholdEvaluator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdEvaluator::addComparison(const IDataArray::Pointer& input, int compOperator, double compValue, int unionOperator)
+{
+  if(nullptr == input)
+  {
+    return false;
+  }
+
+  std::shared_ptr<Node> node = CreateComparisonNode<float>(input, compOperator, compValue, unionOperator);
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<double>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<int8_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<uint8_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<int16_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<uint16_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<int32_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<uint32_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<int64_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<uint64_t>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<bool>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    node = CreateComparisonNode<char>(input, compOperator, compValue, unionOperator);
+  }
+  if(nullptr == node)
+  {
+    return false;
+  }
+
+  static_cast<SetNode*>(m_OpenSets.back())->addEntry(node);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::beginSet(int unionOperator, bool invert)
+{
+  std::shared_ptr<SetNode> set = std::make_shared<SetNode>(unionOperator, invert);
+  static_cast<SetNode*>(m_OpenSets.back())->addEntry(set);
+  m_OpenSets.push_back(set.get());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::endSet()
+{
+  // The root set is never closed
+  if(m_OpenSets.size() > 1)
+  {
+    m_OpenSets.pop_back();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::setInvert(bool invert)
+{
+  static_cast<SetNode*>(m_Root.get())->setInvert(invert);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::execute(bool* output, size_t numTuples) const
+{
+  size_t numBlocks = (numTuples + k_BlockSize - 1) / k_BlockSize;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  bool doParallel = ExecutionContext::IsParallel();
+#endif
+
+  EvaluateThresholdImpl impl(m_Root.get(), output, numTuples);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), impl, tbb::auto_partitioner()); });
+  }
+  else
+#endif
+  {
+    impl.evaluate(0, numBlocks);
+  }
+}
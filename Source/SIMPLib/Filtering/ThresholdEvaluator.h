@@ -0,0 +1,106 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ThresholdEvaluator class compiles a tree of threshold comparisons and evaluates it in a
+ * single pass over the tuples. The tuples are processed in blocks; every comparison writes into a
+ * small block sized buffer that is merged into its parent set straight away, so no full size
+ * intermediate arrays are created. The blocks are evaluated in parallel when TBB is available.
+ *
+ * The tree is built with beginSet(), endSet() and addComparison(). The first entry of a set
+ * initializes the result of the set and every later entry is merged into it with its own union
+ * operator, after which the set is inverted if requested. The comparisons and the evaluator itself
+ * form an implicit root set.
+ */
+class SIMPLib_EXPORT ThresholdEvaluator
+{
+public:
+  ThresholdEvaluator();
+  virtual ~ThresholdEvaluator();
+
+  /**
+   * @brief Adds a comparison of a scalar array against a value to the current set
+   * @param input The array to compare
+   * @param compOperator One of the SIMPL::Comparison::Enumeration values
+   * @param compValue The value that each element is compared against
+   * @param unionOperator One of the SIMPL::Union::Enumeration values
+   * @return False if the type of the array is not supported
+   */
+  bool addComparison(const IDataArray::Pointer& input, int compOperator, double compValue, int unionOperator);
+
+  /**
+   * @brief Starts a nested set. The comparisons that follow are added to it until endSet() is called
+   * @param unionOperator The union operator used to merge the set into its parent
+   * @param invert Whether the result of the set is flipped
+   */
+  void beginSet(int unionOperator, bool invert);
+
+  /**
+   * @brief Finishes the set that was started last
+   */
+  void endSet();
+
+  /**
+   * @brief Sets whether the final result is flipped
+   * @param invert
+   */
+  void setInvert(bool invert);
+
+  /**
+   * @brief Evaluates the comparisons and writes one value per tuple into the output
+   * @param output The destination, which must hold numTuples values
+   * @param numTuples The number of tuples to evaluate
+   */
+  void execute(bool* output, size_t numTuples) const;
+
+  class Node;
+
+private:
+  std::shared_ptr<Node> m_Root;
+  std::vector<Node*> m_OpenSets;
+
+public:
+  ThresholdEvaluator(const ThresholdEvaluator&) = delete;            // Copy Constructor Not Implemented
+  ThresholdEvaluator(ThresholdEvaluator&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdEvaluator& operator=(const ThresholdEvaluator&) = delete; // Copy Assignment Not Implemented
+  ThresholdEvaluator& operator=(ThresholdEvaluator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -33,8 +33,12 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <map>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -42,12 +46,20 @@
 #include "H5Support/H5ScopedErrorHandler.h"
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Geometry/IGeometry.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#endif
+
 /**
 * @brief This file contains a namespace with classes for manipulating IGeometry objects
 */
@@ -255,6 +267,218 @@ public:
   }
 };
 
+/**
+ * @brief The GatherSubElementKeysImpl class fills in the sub-element keys for a range of elements.
+ * Each element writes to its own block of keys so ranges can be processed in parallel.
+ */
+template <typename T, size_t N> class GatherSubElementKeysImpl
+{
+public:
+  GatherSubElementKeysImpl(T* elements, size_t numVertsPerElem, const std::vector<std::array<size_t, N>>& subElements, std::array<T, N>* keys)
+  : m_Elements(elements)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_SubElements(subElements)
+  , m_Keys(keys)
+  {
+  }
+  virtual ~GatherSubElementKeysImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    size_t numSubElements = m_SubElements.size();
+    for(size_t i = start; i < end; i++)
+    {
+      T* verts = m_Elements + i * m_NumVertsPerElem;
+      std::array<T, N>* elemKeys = m_Keys + i * numSubElements;
+      for(size_t s = 0; s < numSubElements; s++)
+      {
+        std::array<T, N>& key = elemKeys[s];
+        for(size_t n = 0; n < N; n++)
+        {
+          key[n] = verts[m_SubElements[s][n]];
+        }
+        std::sort(key.begin(), key.end());
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Elements;
+  size_t m_NumVertsPerElem;
+  const std::vector<std::array<size_t, N>>& m_SubElements;
+  std::array<T, N>* m_Keys;
+};
+
+/**
+ * @brief The FillElementsContainingVertImpl class inserts each element of a range into the lists of
+ * the vertices it uses. The insert position in each list is claimed with an atomic cursor.
+ */
+template <typename T, typename K> class FillElementsContainingVertImpl
+{
+public:
+  FillElementsContainingVertImpl(K* elements, size_t numVertsPerElem, DynamicListArray<T, K>* dynamicList, std::atomic<T>* linkLoc)
+  : m_Elements(elements)
+  , m_NumVertsPerElem(numVertsPerElem)
+  , m_DynamicList(dynamicList)
+  , m_LinkLoc(linkLoc)
+  {
+  }
+  virtual ~FillElementsContainingVertImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t elemId = start; elemId < end; elemId++)
+    {
+      K* verts = m_Elements + elemId * m_NumVertsPerElem;
+      for(size_t j = 0; j < m_NumVertsPerElem; j++)
+      {
+        m_DynamicList->insertCellReference(verts[j], m_LinkLoc[verts[j]]++, elemId);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  K* m_Elements;
+  size_t m_NumVertsPerElem;
+  DynamicListArray<T, K>* m_DynamicList;
+  std::atomic<T>* m_LinkLoc;
+};
+
+/**
+ * @brief The SortElementListsImpl class sorts each list in a range of a DynamicListArray.
+ */
+template <typename T, typename K> class SortElementListsImpl
+{
+public:
+  SortElementListsImpl(DynamicListArray<T, K>* dynamicList)
+  : m_DynamicList(dynamicList)
+  {
+  }
+  virtual ~SortElementListsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      K* list = m_DynamicList->getElementListPointer(i);
+      std::sort(list, list + m_DynamicList->getNumberOfElements(i));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The FindElementNeighborsImpl class finds the neighbors of every element in a range of blocks.
+ * Two elements are neighbors when they share numSharedVerts vertices. The neighbors of all elements in
+ * a block are appended to that block's buffer in element order and the count for each element is
+ * written to linkCount.
+ */
+template <typename T, typename K> class FindElementNeighborsImpl
+{
+public:
+  FindElementNeighborsImpl(typename DataArray<K>::Pointer elemList, DynamicListArray<T, K>* elemsContainingVert, size_t numSharedVerts, size_t blockSize, T* linkCount,
+                           std::vector<K>* blockNeighbors)
+  : m_Elements(elemList->getPointer(0))
+  , m_NumElems(elemList->getNumberOfTuples())
+  , m_NumVertsPerElem(elemList->getNumberOfComponents())
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_NumSharedVerts(numSharedVerts)
+  , m_BlockSize(blockSize)
+  , m_LinkCount(linkCount)
+  , m_BlockNeighbors(blockNeighbors)
+  {
+  }
+  virtual ~FindElementNeighborsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t b = start; b < end; b++)
+    {
+      std::vector<K>& neighbors = m_BlockNeighbors[b];
+      size_t lastElem = std::min((b + 1) * m_BlockSize, m_NumElems);
+      for(size_t t = b * m_BlockSize; t < lastElem; t++)
+      {
+        size_t first = neighbors.size();
+        K* seedElem = m_Elements + t * m_NumVertsPerElem;
+        for(size_t v = 0; v < m_NumVertsPerElem; ++v)
+        {
+          T nEs = m_ElemsContainingVert->getNumberOfElements(seedElem[v]);
+          K* vertIdxs = m_ElemsContainingVert->getElementListPointer(seedElem[v]);
+          for(T vt = 0; vt < nEs; ++vt)
+          {
+            if(vertIdxs[vt] == static_cast<K>(t))
+            {
+              continue;
+            } // This is the same element as our "source"
+            if(std::find(neighbors.begin() + first, neighbors.end(), vertIdxs[vt]) != neighbors.end())
+            {
+              continue;
+            } // We already added this element so loop again
+            K* vertCell = m_Elements + vertIdxs[vt] * m_NumVertsPerElem;
+            size_t vCount = 0;
+            // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
+            for(size_t i = 0; i < m_NumVertsPerElem; i++)
+            {
+              for(size_t j = 0; j < m_NumVertsPerElem; j++)
+              {
+                if(seedElem[i] == vertCell[j])
+                {
+                  vCount++;
+                }
+              }
+            }
+            if(vCount == m_NumSharedVerts)
+            {
+              neighbors.push_back(vertIdxs[vt]);
+            }
+          }
+        }
+        m_LinkCount[t] = static_cast<T>(neighbors.size() - first);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  K* m_Elements;
+  size_t m_NumElems;
+  size_t m_NumVertsPerElem;
+  DynamicListArray<T, K>* m_ElemsContainingVert;
+  size_t m_NumSharedVerts;
+  size_t m_BlockSize;
+  T* m_LinkCount;
+  std::vector<K>* m_BlockNeighbors;
+};
+
 /**
  * @brief The Connectivity class
  */
@@ -265,7 +489,8 @@ public:
   virtual ~Connectivity() = default;
 
   /**
-   * @brief FindElementsContainingVert
+   * @brief FindElementsContainingVert Builds the list of elements that use each vertex. The lists
+   * are stored in compressed sparse row layout and each list is in ascending element order.
    * @param elemList
    * @param dynamicList
    * @param numVerts
@@ -274,37 +499,44 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    K* elems = elemList->getPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
-
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, "_INTERNAL_USE_ONLY_Vertices");
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
-
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
     // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
+    std::vector<T> linkCount(numVerts, 0);
+    for(size_t i = 0; i < numElems * numVertsPerElem; i++)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        linkCount[verts[j]]++;
-      }
+      linkCount[elems[i]]++;
     }
 
-    // Now allocate storage for the links
-    dynamicList->allocateLists(linkCount);
+    // Now allocate storage for the links as a single block
+    dynamicList->allocateCompressedLists(linkCount);
 
-    for(elemId = 0; elemId < numElems; elemId++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = ExecutionContext::IsParallel();
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+      // Elements are inserted in whatever order the threads reach them, so sort each list afterwards
+      // to give the same ascending order as the serial traversal
+      std::vector<std::atomic<T>> linkLoc(numVerts);
+      ExecutionContext::Execute([&] {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), FillElementsContainingVertImpl<T, K>(elems, numVertsPerElem, dynamicList.get(), linkLoc.data()), tbb::auto_partitioner());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), SortElementListsImpl<T, K>(dynamicList.get()), tbb::auto_partitioner());
+      });
+    }
+    else
+#endif
+    {
+      std::vector<T> linkLoc(numVerts, 0);
+      for(size_t elemId = 0; elemId < numElems; elemId++)
       {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
+        K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
+        }
       }
     }
   }
@@ -322,9 +554,7 @@ public:
                                   IGeometry::Type geometryType)
   {
     size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
     int err = 0;
 
     switch(geometryType)
@@ -364,191 +594,142 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, "_INTERNAL_USE_ONLY_Visited");
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    // Each block of elements collects its neighbors into its own buffer. Once every element's count
+    // is known the buffers are copied back to back into the compressed storage of the output list.
+    const size_t blockSize = 4096;
+    size_t numBlocks = (numElems + blockSize - 1) / blockSize;
+    std::vector<T> linkCount(numElems, 0);
+    std::vector<std::vector<K>> blockNeighbors(numBlocks);
+    FindElementNeighborsImpl<T, K> neighborsImpl(elemList, elemsContainingVert.get(), numSharedVerts, blockSize, linkCount.data(), blockNeighbors.data());
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    bool doParallel = ExecutionContext::IsParallel();
+#endif
 
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
     {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
-      for(size_t v = 0; v < numVertsPerElem; ++v)
-      {
-        //   qDebug() << " vert " << v << "\n";
-        T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
-
-        for(T vt = 0; vt < nEs; ++vt)
-        {
-          if(vertIdxs[vt] == static_cast<K>(t))
-          {
-            continue;
-          } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
-          {
-            continue;
-          } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
-          size_t vCount = 0;
-          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
-          for(size_t i = 0; i < numVertsPerElem; i++)
-          {
-            for(size_t j = 0; j < numVertsPerElem; j++)
-            {
-              if(seedElem[i] == vertCell[j])
-              {
-                vCount++;
-              }
-            }
-          }
+      ExecutionContext::Execute([&] {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), neighborsImpl, tbb::auto_partitioner());
+      });
+    }
+    else
+#endif
+    {
+      neighborsImpl.generate(0, numBlocks);
+    }
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
-          if(vCount == numSharedVerts)
-          {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
-          }
-        }
-      }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
+    dynamicList->allocateCompressedLists(linkCount);
+    for(size_t b = 0; b < numBlocks; b++)
+    {
+      if(!blockNeighbors[b].empty())
       {
-        visited[loop_neighbors[k]] = false;
+        ::memcpy(dynamicList->getElementListPointer(b * blockSize), blockNeighbors[b].data(), blockNeighbors[b].size() * sizeof(K));
       }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
     }
 
     return err;
   }
 
   /**
-   * @brief Find2DElementEdges
-   * @param elemList
-   * @param edgeList
+   * @brief FindSortedSubElementKeys Creates one key for every sub-element (edge or face) of every
+   * element in the element list and sorts the keys. Each key holds the vertex ids of the sub-element
+   * in ascending order, so identical sub-elements end up next to each other after the sort.
+   * @param elemList The element list
+   * @param subElements The element local vertex indices of each sub-element
+   * @return
    */
-  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, size_t N> static std::vector<std::array<T, N>> FindSortedSubElementKeys(typename DataArray<T>::Pointer elemList, const std::vector<std::array<size_t, N>>& subElements)
   {
     size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
+    std::vector<std::array<T, N>> keys(numElems * subElements.size());
+    if(keys.empty())
+    {
+      return keys;
+    }
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+    GatherSubElementKeysImpl<T, N> gather(elemList->getPointer(0), elemList->getNumberOfComponents(), subElements, keys.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), gather, tbb::auto_partitioner());
+      tbb::parallel_sort(keys.begin(), keys.end());
+    });
+#else
+    gather.generate(0, numElems);
+    std::sort(keys.begin(), keys.end());
+#endif
+    return keys;
+  }
 
-    for(size_t i = 0; i < numElems; i++)
+  /**
+   * @brief WriteSubElementKeys Copies the sorted keys into the output list. Every distinct key is
+   * written once, unless unsharedOnly is true in which case only keys that occur exactly once are written.
+   * @param keys The sorted keys from FindSortedSubElementKeys
+   * @param unsharedOnly Only write sub-elements that belong to a single element
+   * @param outList The list to resize and fill
+   */
+  template <typename T, size_t N> static void WriteSubElementKeys(const std::vector<std::array<T, N>>& keys, bool unsharedOnly, typename DataArray<T>::Pointer outList)
+  {
+    size_t numKeys = keys.size();
+    size_t count = 0;
+    for(size_t i = 0; i < numKeys;)
     {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
+      size_t j = i + 1;
+      while(j < numKeys && keys[j] == keys[i])
       {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
+        ++j;
       }
+      if(!unsharedOnly || j - i == 1)
+      {
+        ++count;
+      }
+      i = j;
     }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
+    outList->resize(count);
+    T* out = outList->getPointer(0);
+    size_t index = 0;
+    for(size_t i = 0; i < numKeys;)
     {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
+      size_t j = i + 1;
+      while(j < numKeys && keys[j] == keys[i])
+      {
+        ++j;
+      }
+      if(!unsharedOnly || j - i == 1)
+      {
+        std::copy(keys[i].begin(), keys[i].end(), out + N * index);
+        ++index;
+      }
+      i = j;
     }
   }
 
   /**
-   * @brief FindTetEdges
-   * @param tetList
+   * @brief Find2DElementEdges
+   * @param elemList
    * @param edgeList
    */
-  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    std::vector<std::array<size_t, 2>> subElements(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
     {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
+      subElements[j] = {{j, (j + 1) % numVertsPerElem}};
     }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(elemList, subElements), false, edgeList);
+  }
 
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+  /**
+   * @brief FindTetEdges
+   * @param tetList
+   * @param edgeList
+   */
+  template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
+  {
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(tetList, TetEdges()), false, edgeList);
   }
 
   /**
@@ -558,52 +739,7 @@ public:
   */
   template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 =  {verts[4], verts[5]};
-      std::vector<T> edge9 =  {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(hexList, HexEdges()), false, edgeList);
   }
 
   /**
@@ -613,41 +749,7 @@ public:
    */
   template <typename T> static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    WriteSubElementKeys<T, 3>(FindSortedSubElementKeys<T, 3>(tetList, TetFaces()), false, faceList);
   }
 
   /**
@@ -657,45 +759,7 @@ public:
   */
   template <typename T> static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    WriteSubElementKeys<T, 4>(FindSortedSubElementKeys<T, 4>(hexList, HexFaces()), false, faceList);
   }
 
   /**
@@ -705,75 +769,14 @@ public:
    */
   template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
+    std::vector<std::array<size_t, 2>> subElements(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
     {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
+      subElements[j] = {{j, (j + 1) % numVertsPerElem}};
     }
 
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(elemList, subElements), true, edgeList);
   }
 
   /**
@@ -783,55 +786,7 @@ public:
   */
   template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(tetList, TetEdges()), true, edgeList);
   }
 
   /**
@@ -841,65 +796,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    WriteSubElementKeys<T, 2>(FindSortedSubElementKeys<T, 2>(hexList, HexEdges()), true, edgeList);
   }
 
   /**
@@ -909,54 +806,7 @@ public:
    */
   template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    WriteSubElementKeys<T, 3>(FindSortedSubElementKeys<T, 3>(tetList, TetFaces()), true, faceList);
   }
 
   /**
@@ -966,58 +816,40 @@ public:
   */
   template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
-      }
-    }
+    WriteSubElementKeys<T, 4>(FindSortedSubElementKeys<T, 4>(hexList, HexFaces()), true, faceList);
+  }
 
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
+protected:
+  /**
+   * @brief TetEdges Returns the local vertex indices of the 6 edges of a tetrahedron
+   */
+  static std::vector<std::array<size_t, 2>> TetEdges()
+  {
+    return {{{0, 1}}, {{0, 2}}, {{1, 2}}, {{0, 3}}, {{1, 3}}, {{2, 3}}};
+  }
 
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
+  /**
+   * @brief HexEdges Returns the local vertex indices of the 12 edges of a hexahedron
+   */
+  static std::vector<std::array<size_t, 2>> HexEdges()
+  {
+    return {{{0, 1}}, {{1, 2}}, {{2, 3}}, {{3, 0}}, {{0, 4}}, {{1, 5}}, {{2, 6}}, {{3, 7}}, {{4, 5}}, {{5, 6}}, {{6, 7}}, {{7, 4}}};
+  }
 
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+  /**
+   * @brief TetFaces Returns the local vertex indices of the 4 faces of a tetrahedron
+   */
+  static std::vector<std::array<size_t, 3>> TetFaces()
+  {
+    return {{{0, 1, 2}}, {{1, 2, 3}}, {{0, 2, 3}}, {{0, 1, 3}}};
+  }
 
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
-    }
+  /**
+   * @brief HexFaces Returns the local vertex indices of the 6 faces of a hexahedron
+   */
+  static std::vector<std::array<size_t, 4>> HexFaces()
+  {
+    return {{{0, 1, 5, 4}}, {{1, 2, 6, 5}}, {{2, 3, 7, 6}}, {{3, 0, 4, 7}}, {{0, 1, 2, 3}}, {{4, 5, 6, 7}}};
   }
 };
 
@@ -15,9 +15,9 @@
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 
@@ -71,6 +71,7 @@ public:
       }
       counter++;
     }
+    m_Hexas->sendThreadSafeProgressMessage(counter, totalElements);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -556,7 +557,7 @@ void HexahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  resetThreadSafeProgress();
   int64_t numHexas = getNumberOfHexas();
 
   if(observable)
@@ -565,14 +566,15 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numHexas), FindHexDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, numHexas), FindHexDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    });
   }
   else
 #endif
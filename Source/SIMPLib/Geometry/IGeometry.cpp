@@ -34,17 +34,37 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "SIMPLib/Geometry/IGeometry.h"
+
+#include <chrono>
+
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 #include "SIMPLib/Geometry/CompositeTransformContainer.h"
 #include "SIMPLib/Geometry/TransformContainer.h"
 
+namespace
+{
+// Status messages from the parallel geometry kernels are sent at most this many times a second
+const int64_t k_ProgressMessagesPerSecond = 4;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ProgressClockMilliseconds()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 IGeometry::IGeometry()
 : m_TimeValue(0.0f)
 , m_EnableTimeSeries(false)
+, m_ProgressCounter(0)
+, m_LastProgressTime(0)
+, m_LastProgressPercent(0)
 {
 }
 
@@ -90,22 +110,56 @@ QString IGeometry::getGeometryTypeAsString()
 // -----------------------------------------------------------------------------
 void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
 {
-  m_Mutex.lock();
+  int64_t previousCounter = m_ProgressCounter.fetch_add(counter, std::memory_order_relaxed);
+  int64_t progressCounter = previousCounter + counter;
+  if(max <= 0)
+  {
+    return;
+  }
 
-  m_ProgressCounter += counter;
+  // The update that completes the computation always reports it, whatever the rate limit says
+  if(progressCounter >= max)
+  {
+    if(previousCounter < max)
+    {
+      m_LastProgressPercent.store(100, std::memory_order_relaxed);
+      QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(100);
+      notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
+    }
+    return;
+  }
 
-  int64_t progIncrement = max / 100;
-  int64_t prog = 1;
+  int64_t progressInt = progressCounter * 100 / max;
+  if(progressInt <= m_LastProgressPercent.load(std::memory_order_relaxed))
+  {
+    return;
+  }
 
-  if(m_ProgressCounter > prog)
+  int64_t now = ProgressClockMilliseconds();
+  int64_t lastTime = m_LastProgressTime.load(std::memory_order_relaxed);
+  if(now - lastTime < 1000 / k_ProgressMessagesPerSecond)
+  {
+    return;
+  }
+  // Only the thread that claims this time slot sends the message
+  if(!m_LastProgressTime.compare_exchange_strong(lastTime, now, std::memory_order_relaxed))
   {
-    int64_t progressInt = static_cast<int64_t>((static_cast<float>(m_ProgressCounter) / max) * 100.0f);
-    QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
-    notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
-    prog += progIncrement;
+    return;
   }
+  m_LastProgressPercent.store(progressInt, std::memory_order_relaxed);
 
-  m_Mutex.unlock();
+  QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
+  notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::resetThreadSafeProgress()
+{
+  m_ProgressCounter = 0;
+  m_LastProgressTime = 0;
+  m_LastProgressPercent = 0;
 }
 
 // -----------------------------------------------------------------------------
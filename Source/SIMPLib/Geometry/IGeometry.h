@@ -35,7 +35,8 @@
 
 #pragma once
 
-#include <QMutex>
+#include <atomic>
+
 #include <QtCore/QMap>
 #include <QtCore/QString>
 
@@ -409,16 +410,25 @@ class SIMPLib_EXPORT IGeometry : public Observable
 
     AttributeMatrixMap_t m_AttributeMatrices;
 
-    QMutex m_Mutex;
-    int64_t m_ProgressCounter;
+    std::atomic<int64_t> m_ProgressCounter;
+    std::atomic<int64_t> m_LastProgressTime;
+    std::atomic<int64_t> m_LastProgressPercent;
 
     /**
-     * @brief sendThreadSafeProgressMessage
+     * @brief sendThreadSafeProgressMessage Adds counter to the progress of a parallel computation.
+     * Any thread may call this; a status message is sent at most a few times a second and only
+     * when the percent complete has changed. The call that brings the counter up to max always
+     * sends the 100% message.
      * @param counter
      * @param max
      */
     virtual void sendThreadSafeProgressMessage(int64_t counter, int64_t max) final;
 
+    /**
+     * @brief resetThreadSafeProgress Resets the progress counter before a new parallel computation
+     */
+    virtual void resetThreadSafeProgress() final;
+
     /**
      * @brief setElementsContaingVert
      * @param elementsContaingVert
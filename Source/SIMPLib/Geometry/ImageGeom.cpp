@@ -46,330 +46,166 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range3d.h>
+#include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 
+namespace
+{
+// The field rows that one tile of the derivative kernel should keep in cache. Every output row
+// reads its own row plus its neighbours in Y and Z, so a tile touches about three rows per row
+constexpr size_t k_DerivativeTileBytes = 1024 * 1024;
+}
+
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying image
+ * derivative of an arbitrary dimensional field on the underlying image. The spacing of an image
+ * is uniform, so the Jacobian is diagonal and each derivative is a finite difference along one
+ * axis scaled by the inverse spacing. Rows along X are processed as contiguous runs and the Y
+ * range is split into tiles so that the neighbouring rows are still cached when they are reused.
  */
 class FindImageDerivativesImpl
 {
 public:
-  FindImageDerivativesImpl(ImageGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindImageDerivativesImpl(ImageGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs, size_t tileRows)
   : m_Image(image)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_TileRows(tileRows)
   {
+    std::tie(m_Dims[0], m_Dims[1], m_Dims[2]) = m_Image->getDimensions();
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(res[0], res[1], res[2]) = m_Image->getResolution();
+
+    // A direction with a single cell uses a unit spacing and always has a zero difference
+    double spacing[3] = {0.0, 0.0, 0.0};
+    for(size_t i = 0; i < 3; i++)
+    {
+      spacing[i] = (m_Dims[i] == 1) ? 1.0 : static_cast<double>(res[i]);
+    }
+    // A singular Jacobian (a zero spacing) gives a zero derivative in every direction
+    bool singular = (spacing[0] * spacing[1] * spacing[2] == 0.0);
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_InvSpacing[i] = singular ? 0.0 : 1.0 / spacing[i];
+    }
   }
   virtual ~FindImageDerivativesImpl() = default;
 
-  void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
+  void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd) const
   {
-    double xp[3] = {0.0, 0.0, 0.0};
-    double xm[3] = {0.0, 0.0, 0.0};
-    double factor = 0.0;
-    double xxi, yxi, zxi, xeta, yeta, zeta, xzeta, yzeta, zzeta;
-    xxi = yxi = zxi = xeta = yeta = zeta = xzeta = yzeta = zzeta = 0;
-    double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
-    aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
-    size_t index = 0;
-    int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
+    size_t numComps = static_cast<size_t>(m_Field->getNumberOfComponents());
+    const double* fieldPtr = m_Field->getPointer(0);
     double* derivsPtr = m_Derivatives->getPointer(0);
-    std::vector<double> plusValues(numComps);
-    std::vector<double> minusValues(numComps);
-    std::vector<double> dValuesdXi(numComps);
-    std::vector<double> dValuesdEta(numComps);
-    std::vector<double> dValuesdZeta(numComps);
-
-    size_t dims[3] = {0, 0, 0};
-    std::tie(dims[0], dims[1], dims[2]) = m_Image->getDimensions();
+    size_t rowStride = m_Dims[0] * numComps;
+    size_t planeStride = m_Dims[1] * rowStride;
+    int64_t totalElements = static_cast<int64_t>(m_Image->getNumberOfElements());
+    if(rowStride == 0)
+    {
+      return;
+    }
 
-    int64_t counter = 0;
-    size_t totalElements = m_Image->getNumberOfElements();
-    int64_t progIncrement = static_cast<int64_t>(totalElements / 100);
+    // The X stencil is the same for every row: one sided at both ends and centered in between
+    size_t xRuns[3][2] = {{0, numComps}, {numComps, rowStride - numComps}, {rowStride - numComps, rowStride}};
+    size_t xPlus[3] = {numComps, numComps, 0};
+    size_t xMinus[3] = {0, numComps, numComps};
+    double xScale[3] = {m_InvSpacing[0], 0.5 * m_InvSpacing[0], m_InvSpacing[0]};
+    size_t numXRuns = 3;
+    if(m_Dims[0] == 1)
+    {
+      xPlus[0] = xMinus[0] = 0;
+      xScale[0] = 0.0;
+      numXRuns = 1;
+    }
 
-    for(size_t z = zStart; z < zEnd; z++)
+    for(size_t yTile = yStart; yTile < yEnd; yTile += m_TileRows)
     {
-      for(size_t y = yStart; y < yEnd; y++)
+      size_t yTileEnd = std::min(yTile + m_TileRows, yEnd);
+      for(size_t z = zStart; z < zEnd; z++)
       {
-        for(size_t x = xStart; x < xEnd; x++)
+        size_t zPlus = 0;
+        size_t zMinus = 0;
+        double zScale = findStencil(z, 2, zPlus, zMinus);
+        for(size_t y = yTile; y < yTileEnd; y++)
         {
-          //  Xi derivatives (X)
-          if(dims[0] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == (dims[0] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xxi = factor * (xp[0] - xm[0]);
-          yxi = factor * (xp[1] - xm[1]);
-          zxi = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdXi[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Eta derivatives (Y)
-          if(dims[1] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == (dims[1] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xeta = factor * (xp[0] - xm[0]);
-          yeta = factor * (xp[1] - xm[1]);
-          zeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdEta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Zeta derivatives (Z)
-          if(dims[2] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == (dims[2] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xzeta = factor * (xp[0] - xm[0]);
-          yzeta = factor * (xp[1] - xm[1]);
-          zzeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdZeta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          // Now calculate the Jacobian.  Grids occasionally have
-          // singularities, or points where the Jacobian is infinite (the
-          // inverse is zero).  For these cases, we'll set the Jacobian to
-          // zero, which will result in a zero derivative.
-          aj = xxi * yeta * zzeta + yxi * zeta * xzeta + zxi * xeta * yzeta - zxi * yeta * xzeta - yxi * xeta * zzeta - xxi * zeta * yzeta;
-          if(aj != 0.0)
-          {
-            aj = 1.0 / aj;
-          }
-
-          //  Xi metrics
-          xix = aj * (yeta * zzeta - zeta * yzeta);
-          xiy = -aj * (xeta * zzeta - zeta * xzeta);
-          xiz = aj * (xeta * yzeta - yeta * xzeta);
-
-          //  Eta metrics
-          etax = -aj * (yxi * zzeta - zxi * yzeta);
-          etay = aj * (xxi * zzeta - zxi * xzeta);
-          etaz = -aj * (xxi * yzeta - yxi * xzeta);
-
-          //  Zeta metrics
-          zetax = aj * (yxi * zeta - zxi * yeta);
-          zetay = -aj * (xxi * zeta - zxi * xeta);
-          zetaz = aj * (xxi * yeta - yxi * xeta);
-
-          // Compute the actual derivatives
-          index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-          for(int32_t i = 0; i < numComps; i++)
+          size_t yPlus = 0;
+          size_t yMinus = 0;
+          double yScale = findStencil(y, 1, yPlus, yMinus);
+
+          size_t rowOffset = z * planeStride + y * rowStride;
+          const double* row = fieldPtr + rowOffset;
+          const double* yPlusRow = fieldPtr + z * planeStride + yPlus * rowStride;
+          const double* yMinusRow = fieldPtr + z * planeStride + yMinus * rowStride;
+          const double* zPlusRow = fieldPtr + zPlus * planeStride + y * rowStride;
+          const double* zMinusRow = fieldPtr + zMinus * planeStride + y * rowStride;
+          double* out = derivsPtr + rowOffset * 3;
+
+          for(size_t r = 0; r < numXRuns; r++)
           {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
+            computeRun(xRuns[r][1] - xRuns[r][0], row + xRuns[r][0] + xPlus[r], row + xRuns[r][0] - xMinus[r], xScale[r], yPlusRow + xRuns[r][0], yMinusRow + xRuns[r][0], yScale,
+                       zPlusRow + xRuns[r][0], zMinusRow + xRuns[r][0], zScale, out + xRuns[r][0] * 3);
           }
-
-          if(counter > progIncrement)
-          {
-            m_Image->sendThreadSafeProgressMessage(counter, totalElements);
-            counter = 0;
-          }
-          counter++;
         }
+        m_Image->sendThreadSafeProgressMessage(static_cast<int64_t>((yTileEnd - yTile) * m_Dims[0]), totalElements);
       }
     }
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range3d<size_t, size_t, size_t>& r) const
+  void operator()(const tbb::blocked_range2d<size_t>& r) const
   {
-    compute(r.pages().begin(), r.pages().end(), r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
+    compute(r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
   }
 #endif
 
-  void computeIndices(int32_t differenceType, int32_t directionType, size_t& index1, size_t& index2, size_t dims[3], size_t x, size_t y, size_t z, double xp[3], double xm[3]) const
-
+  /**
+   * @brief Finds the neighbouring cells of a cell along the Y or Z direction and returns the
+   * factor that turns their difference into a derivative
+   */
+  double findStencil(size_t index, size_t direction, size_t& plus, size_t& minus) const
   {
-    size_t tmpIndex1 = 0;
-    size_t tmpIndex2 = 0;
-
-    switch(directionType)
-    {
-    case XDirection:
+    size_t dim = m_Dims[direction];
+    if(dim == 1)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = x + 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(tmpIndex1, y, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x + 1;
-        tmpIndex2 = x - 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(tmpIndex2, y, z, xm);
-      }
-      break;
+      plus = minus = index;
+      return 0.0;
     }
-    case YDirection:
+    if(index == 0)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, tmpIndex1, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        tmpIndex2 = y - 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, tmpIndex2, z, xm);
-      }
-      break;
-    }
-    case ZDirection:
-    {
-      if(differenceType == LeftSide)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, y, tmpIndex1, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        tmpIndex2 = z - 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, tmpIndex2, xm);
-      }
-      break;
+      plus = 1;
+      minus = 0;
+      return m_InvSpacing[direction];
     }
-    default:
+    if(index == dim - 1)
     {
-      break;
-    }
+      plus = index;
+      minus = index - 1;
+      return m_InvSpacing[direction];
     }
+    plus = index + 1;
+    minus = index - 1;
+    return 0.5 * m_InvSpacing[direction];
   }
 
-  void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
+  /**
+   * @brief Computes the three derivatives of a contiguous run of values within one X row. The
+   * pointers are already offset to the start of the run, and the outputs of one value are adjacent
+   * so the loop stores contiguously and vectorizes.
+   */
+  static void computeRun(size_t count, const double* xPlus, const double* xMinus, double xScale, const double* yPlus, const double* yMinus, double yScale, const double* zPlus, const double* zMinus,
+                         double zScale, double* out)
   {
-    size_t index1 = 0;
-    size_t index2 = 0;
-
-    factor = 1.0;
-
-    if(differenceType == TwoDimensional)
-    {
-      for(size_t i = 0; i < 3; i++)
-      {
-        xp[i] = xm[i] = 0.0;
-      }
-      xp[directionType] = 1.0;
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = minusValues[i] = 0.0;
-      }
-    }
-    else
+    for(size_t i = 0; i < count; i++)
     {
-      computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
-      }
-    }
-
-    if(differenceType == Centered)
-    {
-      factor = 0.5;
+      out[i * 3] = (xPlus[i] - xMinus[i]) * xScale;
+      out[i * 3 + 1] = (yPlus[i] - yMinus[i]) * yScale;
+      out[i * 3 + 2] = (zPlus[i] - zMinus[i]) * zScale;
     }
   }
 
@@ -377,21 +213,9 @@ private:
   ImageGeom* m_Image;
   DoubleArrayType::Pointer m_Field;
   DoubleArrayType::Pointer m_Derivatives;
-
-  enum FiniteDifferenceType_t
-  {
-    TwoDimensional = 0,
-    LeftSide,
-    RightSide,
-    Centered
-  };
-
-  enum DirectionType_t
-  {
-    XDirection = 0,
-    YDirection,
-    ZDirection
-  };
+  size_t m_TileRows;
+  size_t m_Dims[3] = {0, 0, 0};
+  double m_InvSpacing[3] = {0.0, 0.0, 0.0};
 };
 
 // -----------------------------------------------------------------------------
@@ -878,7 +702,7 @@ void ImageGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  resetThreadSafeProgress();
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -887,30 +711,24 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  // Size the Y tiles so that the rows read by one tile fit in the cache
+  size_t rowBytes = std::max(dims[0] * static_cast<size_t>(field->getNumberOfComponents()) * sizeof(double), static_cast<size_t>(1));
+  size_t tileRows = std::max(k_DerivativeTileBytes / (3 * rowBytes), static_cast<size_t>(1));
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
+  FindImageDerivativesImpl impl(this, field, derivatives, tileRows);
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / init.default_num_threads();
-
-  if(grain == 0) // This can happen if dims[2] > number of processors
-  {
-    grain = 1;
-  }
-
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindImageDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range2d<size_t>(0, dims[2], 1, 0, dims[1], tileRows), impl, tbb::auto_partitioner()); });
   }
   else
 #endif
   {
-    FindImageDerivativesImpl serial(this, field, derivatives);
-    serial.compute(0, dims[2], 0, dims[1], 0, dims[0]);
+    impl.compute(0, dims[2], 0, dims[1]);
   }
 }
 
@@ -50,9 +50,9 @@
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Common/ExecutionContext.h"
 #if defined SIMPL_USE_EIGEN
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #endif
@@ -107,6 +107,7 @@ public:
       }
       counter++;
     }
+    m_Quads->sendThreadSafeProgressMessage(counter, totalElements);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -499,7 +500,7 @@ void QuadGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  resetThreadSafeProgress();
   int64_t numQuads = getNumberOfQuads();
 
   if(observable)
@@ -508,14 +509,15 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    });
   }
   else
 #endif
@@ -49,10 +49,10 @@
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 
@@ -226,6 +226,7 @@ public:
         }
       }
     }
+    m_RectGrid->sendThreadSafeProgressMessage(counter, totalElements);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -926,7 +927,7 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  resetThreadSafeProgress();
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -936,20 +937,21 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / init.default_num_threads();
+  size_t grain = dims[2] == 1 ? 1 : dims[2] / ExecutionContext::GetNumThreads();
   if(grain == 0)
   {
     grain = 1;
   }
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindRectGridDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
+                        FindRectGridDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    });
   }
   else
 #endif
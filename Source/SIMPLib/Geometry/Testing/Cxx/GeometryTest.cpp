@@ -0,0 +1,265 @@
+#include <stdlib.h>
+
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryTest
+{
+public:
+  GeometryTest() = default;
+
+  virtual ~GeometryTest() = default;
+
+  using ElementList = std::vector<std::vector<int64_t>>;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void FillList(Int64ArrayType::Pointer list, const ElementList& elements)
+  {
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfTuples(), elements.size())
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+      for(size_t j = 0; j < elements[i].size(); j++)
+      {
+        list->setComponent(i, static_cast<int>(j), elements[i][j]);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckList(Int64ArrayType::Pointer list, const ElementList& expected)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(list.get())
+    DREAM3D_REQUIRE_EQUAL(list->getNumberOfTuples(), expected.size())
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(list->getNumberOfComponents()), expected[i].size())
+      for(size_t j = 0; j < expected[i].size(); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(list->getComponent(i, static_cast<int>(j)), expected[i][j])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two triangles that share the edge (1, 2)
+  // -----------------------------------------------------------------------------
+  void TestTriangleEdges()
+  {
+    SharedTriList::Pointer tris = TriangleGeom::CreateSharedTriList(2);
+    FillList(tris, {{0, 1, 2}, {1, 3, 2}});
+    TriangleGeom::Pointer geom = TriangleGeom::CreateGeometry(tris, TriangleGeom::CreateSharedVertexList(4), "Triangles");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    CheckList(geom->getEdges(), {{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 3}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    CheckList(geom->getUnsharedEdges(), {{0, 1}, {0, 2}, {1, 3}, {2, 3}});
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two quads that share the edge (1, 4)
+  // -----------------------------------------------------------------------------
+  void TestQuadEdges()
+  {
+    SharedQuadList::Pointer quads = QuadGeom::CreateSharedQuadList(2);
+    FillList(quads, {{0, 1, 4, 3}, {1, 2, 5, 4}});
+    QuadGeom::Pointer geom = QuadGeom::CreateGeometry(quads, QuadGeom::CreateSharedVertexList(6), "Quads");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    CheckList(geom->getEdges(), {{0, 1}, {0, 3}, {1, 2}, {1, 4}, {2, 5}, {3, 4}, {4, 5}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    CheckList(geom->getUnsharedEdges(), {{0, 1}, {0, 3}, {1, 2}, {2, 5}, {3, 4}, {4, 5}});
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two tetrahedra that share the face (1, 2, 3)
+  // -----------------------------------------------------------------------------
+  void TestTetEdgesAndFaces()
+  {
+    SharedTetList::Pointer tets = TetrahedralGeom::CreateSharedTetList(2);
+    FillList(tets, {{0, 1, 2, 3}, {1, 2, 3, 4}});
+    TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(tets, TetrahedralGeom::CreateSharedVertexList(5), "Tetrahedra");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    CheckList(geom->getEdges(), {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    CheckList(geom->getUnsharedEdges(), {{0, 1}, {0, 2}, {0, 3}, {1, 4}, {2, 4}, {3, 4}});
+
+    DREAM3D_REQUIRE(geom->findFaces() >= 0)
+    CheckList(geom->getTriangles(), {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}, {1, 2, 4}, {1, 3, 4}, {2, 3, 4}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedFaces() >= 0)
+    CheckList(geom->getUnsharedFaces(), {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 4}, {1, 3, 4}, {2, 3, 4}});
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two hexahedra on a 3 x 2 x 2 grid of vertices that share the face (1, 4, 7, 10)
+  // -----------------------------------------------------------------------------
+  void TestHexEdgesAndFaces()
+  {
+    SharedHexList::Pointer hexas = HexahedralGeom::CreateSharedHexList(2);
+    FillList(hexas, {{0, 1, 4, 3, 6, 7, 10, 9}, {1, 2, 5, 4, 7, 8, 11, 10}});
+    HexahedralGeom::Pointer geom = HexahedralGeom::CreateGeometry(hexas, HexahedralGeom::CreateSharedVertexList(12), "Hexahedra");
+
+    DREAM3D_REQUIRE(geom->findEdges() >= 0)
+    CheckList(geom->getEdges(), {{0, 1}, {0, 3}, {0, 6}, {1, 2}, {1, 4}, {1, 7}, {2, 5}, {2, 8}, {3, 4}, {3, 9},
+                                 {4, 5}, {4, 10}, {5, 11}, {6, 7}, {6, 9}, {7, 8}, {7, 10}, {8, 11}, {9, 10}, {10, 11}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedEdges() >= 0)
+    CheckList(geom->getUnsharedEdges(), {{0, 1}, {0, 3}, {0, 6}, {1, 2}, {2, 5}, {2, 8}, {3, 4}, {3, 9},
+                                         {4, 5}, {5, 11}, {6, 7}, {6, 9}, {7, 8}, {8, 11}, {9, 10}, {10, 11}});
+
+    DREAM3D_REQUIRE(geom->findFaces() >= 0)
+    CheckList(geom->getQuads(), {{0, 1, 3, 4}, {0, 1, 6, 7}, {0, 3, 6, 9}, {1, 2, 4, 5}, {1, 2, 7, 8}, {1, 4, 7, 10},
+                                 {2, 5, 8, 11}, {3, 4, 9, 10}, {4, 5, 10, 11}, {6, 7, 9, 10}, {7, 8, 10, 11}});
+
+    DREAM3D_REQUIRE(geom->findUnsharedFaces() >= 0)
+    CheckList(geom->getUnsharedFaces(), {{0, 1, 3, 4}, {0, 1, 6, 7}, {0, 3, 6, 9}, {1, 2, 4, 5}, {1, 2, 7, 8},
+                                         {2, 5, 8, 11}, {3, 4, 9, 10}, {4, 5, 10, 11}, {6, 7, 9, 10}, {7, 8, 10, 11}});
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompareDynamicLists(ElementDynamicList::Pointer serial, ElementDynamicList::Pointer parallel)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(serial.get())
+    DREAM3D_REQUIRE_VALID_POINTER(parallel.get())
+    DREAM3D_REQUIRE_EQUAL(serial->size(), parallel->size())
+    for(size_t i = 0; i < serial->size(); i++)
+    {
+      uint16_t numElements = serial->getNumberOfElements(i);
+      DREAM3D_REQUIRE_EQUAL(numElements, parallel->getNumberOfElements(i))
+      int64_t* serialList = serial->getElementListPointer(i);
+      int64_t* parallelList = parallel->getElementListPointer(i);
+      for(uint16_t j = 0; j < numElements; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(serialList[j], parallelList[j])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds the connectivity once on a single thread and once on several threads and requires
+  // the same lists, in the same order, from both
+  // -----------------------------------------------------------------------------
+  void CompareSerialAndParallelConnectivity(IGeometry::Pointer geom)
+  {
+    int maxThreads = ExecutionContext::GetMaxThreads();
+
+    ExecutionContext::SetMaxThreads(1);
+    DREAM3D_REQUIRE(geom->findElementsContainingVert() >= 0)
+    DREAM3D_REQUIRE(geom->findElementNeighbors() >= 0)
+    ElementDynamicList::Pointer serialContaining = geom->getElementsContainingVert();
+    ElementDynamicList::Pointer serialNeighbors = geom->getElementNeighbors();
+
+    ExecutionContext::SetMaxThreads(4);
+    int err = geom->findElementsContainingVert();
+    if(err >= 0)
+    {
+      err = geom->findElementNeighbors();
+    }
+    ExecutionContext::SetMaxThreads(maxThreads);
+    DREAM3D_REQUIRE(err >= 0)
+
+    CompareDynamicLists(serialContaining, geom->getElementsContainingVert());
+    CompareDynamicLists(serialNeighbors, geom->getElementNeighbors());
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two triangles per cell of a 100 x 100 grid and one hexahedron per cell of a 24 x 24 x 24 grid,
+  // so both meshes span several of the blocks that the neighbor search hands to each thread
+  // -----------------------------------------------------------------------------
+  void TestParallelConnectivity()
+  {
+    const int64_t n = 100;
+    SharedTriList::Pointer tris = TriangleGeom::CreateSharedTriList(2 * n * n);
+    for(int64_t y = 0; y < n; y++)
+    {
+      for(int64_t x = 0; x < n; x++)
+      {
+        int64_t v0 = y * (n + 1) + x;
+        int64_t v1 = v0 + 1;
+        int64_t v2 = v0 + n + 1;
+        int64_t v3 = v2 + 1;
+        int64_t* tri = tris->getTuplePointer(2 * (y * n + x));
+        tri[0] = v0;
+        tri[1] = v1;
+        tri[2] = v3;
+        tri[3] = v0;
+        tri[4] = v3;
+        tri[5] = v2;
+      }
+    }
+    TriangleGeom::Pointer triGeom = TriangleGeom::CreateGeometry(tris, TriangleGeom::CreateSharedVertexList((n + 1) * (n + 1)), "Triangles");
+    CompareSerialAndParallelConnectivity(triGeom);
+
+    // Every interior triangle shares an edge with three others
+    ElementDynamicList::Pointer triNeighbors = triGeom->getElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(triNeighbors->getNumberOfElements(2 * (n + 1)), 3)
+
+    const int64_t m = 24;
+    SharedHexList::Pointer hexas = HexahedralGeom::CreateSharedHexList(m * m * m);
+    for(int64_t z = 0; z < m; z++)
+    {
+      for(int64_t y = 0; y < m; y++)
+      {
+        for(int64_t x = 0; x < m; x++)
+        {
+          int64_t v0 = (z * (m + 1) + y) * (m + 1) + x;
+          int64_t up = (m + 1) * (m + 1);
+          int64_t* hex = hexas->getTuplePointer((z * m + y) * m + x);
+          hex[0] = v0;
+          hex[1] = v0 + 1;
+          hex[2] = v0 + m + 2;
+          hex[3] = v0 + m + 1;
+          hex[4] = v0 + up;
+          hex[5] = v0 + up + 1;
+          hex[6] = v0 + up + m + 2;
+          hex[7] = v0 + up + m + 1;
+        }
+      }
+    }
+    HexahedralGeom::Pointer hexGeom = HexahedralGeom::CreateGeometry(hexas, HexahedralGeom::CreateSharedVertexList((m + 1) * (m + 1) * (m + 1)), "Hexahedra");
+    CompareSerialAndParallelConnectivity(hexGeom);
+
+    // Every interior hexahedron shares a face with six others
+    ElementDynamicList::Pointer hexNeighbors = hexGeom->getElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(hexNeighbors->getNumberOfElements((m + 1) * m + 1), 6)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTriangleEdges());
+    DREAM3D_REGISTER_TEST(TestQuadEdges());
+    DREAM3D_REGISTER_TEST(TestTetEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestHexEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestParallelConnectivity());
+  }
+
+private:
+  GeometryTest(const GeometryTest&) = delete;   // Copy Constructor Not Implemented
+  void operator=(const GeometryTest&) = delete; // Move assignment Not Implemented
+};
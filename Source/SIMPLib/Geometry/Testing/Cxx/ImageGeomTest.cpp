@@ -1,10 +1,12 @@
 
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
 
 #include <QtCore/QFile>
 
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
@@ -91,6 +93,63 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindDerivatives()
+  {
+    // Two linear fields have the same derivative in every cell, including the one sided
+    // differences on the boundaries. The last case is a single slice with no Z derivative.
+    size_t allDims[2][3] = {{9, 7, 5}, {40, 30, 1}};
+    float res[3] = {0.5f, 2.0f, 1.5f};
+    double slopes[2][3] = {{3.0, -2.0, 0.5}, {-1.0, 4.0, 2.0}};
+
+    for(size_t c = 0; c < 2; c++)
+    {
+      size_t* dims = allDims[c];
+      ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+      geom->setDimensions(dims);
+      geom->setResolution(res);
+
+      size_t numCells = dims[0] * dims[1] * dims[2];
+      QVector<size_t> cDims(1, 2);
+      DoubleArrayType::Pointer field = DoubleArrayType::CreateArray(numCells, cDims, "Field", true);
+      cDims[0] = 6;
+      DoubleArrayType::Pointer derivs = DoubleArrayType::CreateArray(numCells, cDims, "Derivatives", true);
+      derivs->initializeWithZeros();
+
+      for(size_t z = 0; z < dims[2]; z++)
+      {
+        for(size_t y = 0; y < dims[1]; y++)
+        {
+          for(size_t x = 0; x < dims[0]; x++)
+          {
+            size_t index = (z * dims[1] + y) * dims[0] + x;
+            double coords[3] = {x * res[0], y * res[1], z * res[2]};
+            for(size_t i = 0; i < 2; i++)
+            {
+              field->setComponent(index, i, slopes[i][0] * coords[0] + slopes[i][1] * coords[1] + slopes[i][2] * coords[2]);
+            }
+          }
+        }
+      }
+
+      geom->findDerivatives(field, derivs);
+
+      for(size_t index = 0; index < numCells; index++)
+      {
+        for(size_t i = 0; i < 2; i++)
+        {
+          for(size_t j = 0; j < 3; j++)
+          {
+            double expected = (dims[j] == 1) ? 0.0 : slopes[i][j];
+            DREAM3D_REQUIRE(std::fabs(derivs->getComponent(index, i * 3 + j) - expected) < 1.0E-9)
+          }
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -101,6 +160,7 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestFindDerivatives());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
@@ -1,6 +1,7 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
   ImageGeomTest
+  GeometryTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
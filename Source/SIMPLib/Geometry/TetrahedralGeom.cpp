@@ -50,9 +50,9 @@
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
 #endif
 
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 
@@ -106,6 +106,7 @@ public:
       }
       counter++;
     }
+    m_Tets->sendThreadSafeProgressMessage(counter, totalElements);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -573,7 +574,7 @@ void TetrahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
+  resetThreadSafeProgress();
   int64_t numTets = getNumberOfTets();
 
   if(observable)
@@ -582,14 +583,15 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
+  bool doParallel = ExecutionContext::IsParallel();
 #endif
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    ExecutionContext::Execute([&] {
+      tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    });
   }
   else
 #endif
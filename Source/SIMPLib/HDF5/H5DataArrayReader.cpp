@@ -35,11 +35,14 @@
 
 #include "H5DataArrayReader.h"
 
+#include <functional>
+#include <numeric>
 #include <vector>
 
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
+#include "SIMPLib/DataArrays/BitMaskArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -61,7 +64,7 @@ namespace Detail
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const QVector<size_t>& tDims, const QVector<size_t>& cDims)
+template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const QVector<size_t>& tDims, const QVector<size_t>& cDims, const QVector<size_t>& tupleOffset)
 {
   herr_t err = -1;
   IDataArray::Pointer ptr;
@@ -69,7 +72,27 @@ template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QStri
   ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath);
 
   T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  if(tupleOffset.isEmpty())
+  {
+    err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  }
+  else
+  {
+    // The HDF5 dimensions are the reversed tuple dimensions followed by the reversed
+    // component dimensions (See H5DataArrayWriter). Only the tuple dimensions are sliced.
+    QVector<hsize_t> offset(tDims.size() + cDims.size(), 0);
+    QVector<hsize_t> count(tDims.size() + cDims.size(), 0);
+    for(int i = 0; i < tDims.size(); i++)
+    {
+      offset[tDims.size() - 1 - i] = tupleOffset[i];
+      count[tDims.size() - 1 - i] = tDims[i];
+    }
+    for(int i = 0; i < cDims.size(); i++)
+    {
+      count[tDims.size() + cDims.size() - 1 - i] = cDims[i];
+    }
+    err = QH5Lite::readPointerDatasetHyperslab(locId, datasetPath, offset, count, data);
+  }
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
@@ -77,6 +100,77 @@ template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QStri
   }
   return ptr;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isValidSubregion(const QString& name, const QVector<size_t>& tDims, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  if(tupleOffset.size() != tDims.size() || tupleCount.size() != tDims.size())
+  {
+    qDebug() << "The tuple subregion for " << name << " does not have the same rank as its tuple dimensions " << tDims;
+    return false;
+  }
+  for(int i = 0; i < tDims.size(); i++)
+  {
+    if(tupleCount[i] == 0 || tupleOffset[i] + tupleCount[i] > tDims[i])
+    {
+      qDebug() << "The tuple subregion for " << name << " lies outside its tuple dimensions " << tDims;
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Arrays that can not be read as a hyperslab (strings, neighbor lists) are read
+// whole and then have every tuple outside of the subregion erased.
+// -----------------------------------------------------------------------------
+IDataArray::Pointer cropToSubregion(IDataArray::Pointer ptr, const QVector<size_t>& tDims, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  if(nullptr == ptr.get() || tupleOffset.isEmpty())
+  {
+    return ptr;
+  }
+  if(!isValidSubregion(ptr->getName(), tDims, tupleOffset, tupleCount))
+  {
+    return IDataArray::NullPointer();
+  }
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  size_t numSubTuples = std::accumulate(tupleCount.begin(), tupleCount.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(!ptr->isAllocated() || ptr->getNumberOfTuples() != numTuples)
+  {
+    ptr->resize(numSubTuples);
+    return ptr;
+  }
+
+  QVector<size_t> idxs;
+  idxs.reserve(static_cast<int>(numTuples - numSubTuples));
+  for(size_t t = 0; t < numTuples; t++)
+  {
+    size_t rem = t;
+    bool inside = true;
+    for(int d = 0; d < tDims.size(); d++)
+    {
+      size_t coord = rem % tDims[d];
+      rem = rem / tDims[d];
+      if(coord < tupleOffset[d] || coord >= tupleOffset[d] + tupleCount[d])
+      {
+        inside = false;
+        break;
+      }
+    }
+    if(!inside)
+    {
+      idxs.push_back(t);
+    }
+  }
+  if(ptr->eraseTuples(idxs) < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  return ptr;
+}
 }
 
 // -----------------------------------------------------------------------------
@@ -121,7 +215,7 @@ int H5DataArrayReader::ReadRequiredAttributes(hid_t gid, const QString& name, QS
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly)
+IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
 {
   herr_t err = -1;
   // herr_t retErr = 1;
@@ -174,13 +268,7 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   // dimensions does not make sense.
   StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name);
 
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
-  {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
-  }
+  err = strTemp->readH5Data(gid);
   if(err < 0)
   {
     err = H5Tclose(typeId);
@@ -189,13 +277,48 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
 
   ptr = strTemp;
 
-  return ptr;
+  return Detail::cropToSubregion(ptr, tDims, tupleOffset, tupleCount);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly)
+IDataArray::Pointer H5DataArrayReader::ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
+{
+  QString classType;
+  int version = 0;
+  QVector<size_t> tDims;
+  QVector<size_t> cDims;
+
+  int err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+
+  BitMaskArray::Pointer ptr = BitMaskArray::CreateArray(numTuples, name, !metaDataOnly);
+  if(nullptr == ptr.get())
+  {
+    return IDataArray::NullPointer();
+  }
+  if(!metaDataOnly)
+  {
+    err = ptr->readH5Data(gid);
+    if(err < 0)
+    {
+      qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
+      return IDataArray::NullPointer();
+    }
+  }
+
+  return Detail::cropToSubregion(ptr, tDims, tupleOffset, tupleCount);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
 {
 
   herr_t err = -1;
@@ -232,12 +355,23 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       return ptr;
     }
 
+    // Only the requested subregion of the tuples is read when one is given
+    if(!tupleOffset.isEmpty())
+    {
+      if(!Detail::isValidSubregion(name, tDims, tupleOffset, tupleCount))
+      {
+        H5Tclose(typeId);
+        return ptr;
+      }
+      tDims = tupleCount;
+    }
+
     // Check to see if we are reading a bool array and if so read it and return
     if(classType.compare("DataArray<bool>") == 0)
     {
       if(metaDataOnly == false)
       {
-        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims);
+        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims, tupleOffset);
       }
       else
       {
@@ -264,7 +398,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -275,7 +409,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -286,7 +420,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -297,7 +431,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -308,7 +442,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -319,7 +453,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -330,7 +464,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -341,7 +475,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -359,7 +493,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -370,7 +504,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(metaDataOnly == false)
         {
-          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims, tupleOffset);
         }
         else
         {
@@ -397,7 +531,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QString& name, bool metaDataOnly)
+IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QString& name, bool metaDataOnly, const QVector<size_t>& tupleOffset, const QVector<size_t>& tupleCount)
 {
 
   herr_t err = -1;
@@ -407,6 +541,7 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   QString res;
 
   QVector<hsize_t> dims; // Reusable for the loop
+  QVector<size_t> tDims;
   IDataArray::Pointer iDataArray = IDataArray::NullPointer();
   // qDebug() << "Reading Attribute " << *iter ;
   typeId = QH5Lite::getDatasetType(gid, name);
@@ -419,7 +554,6 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   {
     QString classType;
     int version = 0;
-    QVector<size_t> tDims;
     QVector<size_t> cDims;
 
     err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
@@ -549,5 +683,5 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   {
     iDataArray = IDataArray::NullPointer();
   }
-  return iDataArray;
+  return Detail::cropToSubregion(iDataArray, tDims, tupleOffset, tupleCount);
 }
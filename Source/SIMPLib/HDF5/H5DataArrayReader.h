@@ -39,6 +39,7 @@
 #include <hdf5.h>
 
 #include <QtCore/QString>
+#include <QtCore/QVector>
 
 
 #include "SIMPLib/SIMPLib.h"
@@ -72,27 +73,49 @@ class SIMPLib_EXPORT H5DataArrayReader
      * @param gid The HDF5 Group to read the data array from
      * @param name The name of the data set
      * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @param tupleOffset Optional start of the tuple subregion to read (XYZ order). Only that hyperslab is
+     * read from the file. Empty reads every tuple
+     * @param tupleCount Extent of the tuple subregion to read (XYZ order)
      * @return
      */
-    static IDataArray::Pointer ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+    static IDataArray::Pointer ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                              const QVector<size_t>& tupleCount = QVector<size_t>());
 
     /**
      * @brief ReadNeighborListData
      * @param gid The HDF5 Group to read the data array from
      * @param name The name of the data set
      * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @param tupleOffset Optional start of the tuple subregion to read (XYZ order). Empty reads every tuple
+     * @param tupleCount Extent of the tuple subregion to read (XYZ order)
      * @return
      */
-    static IDataArray::Pointer ReadNeighborListData(hid_t gid, const QString& name, bool metaDataOnly = false);
+    static IDataArray::Pointer ReadNeighborListData(hid_t gid, const QString& name, bool metaDataOnly = false, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                                    const QVector<size_t>& tupleCount = QVector<size_t>());
 
     /**
      * @brief readStringDataArray
      * @param gid The HDF5 Group to read the data array from
      * @param name The name of the data set
      * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @param tupleOffset Optional start of the tuple subregion to read (XYZ order). Empty reads every tuple
+     * @param tupleCount Extent of the tuple subregion to read (XYZ order)
      * @return
      */
-    static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+    static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                                   const QVector<size_t>& tupleCount = QVector<size_t>());
+
+    /**
+     * @brief readBitMaskArray
+     * @param gid The HDF5 Group to read the data array from
+     * @param name The name of the data set
+     * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @param tupleOffset Optional start of the tuple subregion to read (XYZ order). Empty reads every tuple
+     * @param tupleCount Extent of the tuple subregion to read (XYZ order)
+     * @return
+     */
+    static IDataArray::Pointer ReadBitMaskArray(hid_t gid, const QString& name, bool metaDataOnly = false, const QVector<size_t>& tupleOffset = QVector<size_t>(),
+                                                const QVector<size_t>& tupleCount = QVector<size_t>());
 
 
   protected:
@@ -198,13 +198,20 @@ class H5DataArrayWriter
     {
       int err = 0;
 
-      std::vector<std::string> data(dataArray->getNumberOfTuples());
-      for(int i = 0; i < data.size(); i++)
+      // The array already stores its values as null terminated UTF-8 so the
+      // pointers can be handed to HDF5 directly and written with one H5Dwrite.
+      size_t numTuples = dataArray->getNumberOfTuples();
+      std::vector<const char*> data(numTuples);
+      for(size_t i = 0; i < numTuples; i++)
       {
-        data[i] = dataArray->getValue(i).toStdString();
+        data[i] = dataArray->getUtf8Data(i);
       }
 
       err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data);
+      if(err < 0)
+      {
+        return err;
+      }
       QVector<size_t> tDims(1, dataArray->getNumberOfTuples());
       QVector<size_t> cDims(1, 1);
       err = writeDataArrayAttributes<T>(gid, dataArray, tDims, cDims);
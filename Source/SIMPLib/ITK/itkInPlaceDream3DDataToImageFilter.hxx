@@ -1,6 +1,7 @@
 #pragma once
 
 #include "itkInPlaceDream3DDataToImageFilter.h"
+#include "SIMPLib/DataArrays/DataArrayStorage.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 namespace itk
@@ -123,6 +124,7 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
   IDataArray::Pointer dataArray = ma->getAttributeArray(m_DataArrayName.c_str());
   size_t size = dataArray->getSize();
   PixelType *buffer;
+  bool containerOwnsBuffer = m_PixelContainerWillOwnTheBuffer;
   if(m_InPlace)
   {
     if (m_PixelContainerWillOwnTheBuffer)
@@ -130,10 +132,17 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
       dataArray->releaseOwnership();
     }
     buffer = static_cast<PixelType*>(dataArray->getVoidPointer( 0 ));
+    // A memory mapped buffer is still owned by the DataArray (it could not be moved to the heap) and
+    // must never be freed by the pixel container
+    if(containerOwnsBuffer && DataArrayStorage::IsMemoryMapped(buffer))
+    {
+      containerOwnsBuffer = false;
+    }
   }
   else
   {
     m_PixelContainerWillOwnTheBuffer = true;
+    containerOwnsBuffer = true;
     buffer = new PixelType[size];
     ::memcpy( buffer, static_cast<PixelType*>(dataArray->getVoidPointer( 0 )), size * sizeof( PixelType ) );
   }
@@ -141,7 +150,7 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
   {
     m_ImportImageContainer = ImportImageContainerType::New();
     m_ImportImageContainer->SetImportPointer( buffer,
-        size, m_PixelContainerWillOwnTheBuffer);
+        size, containerOwnsBuffer);
   }
   // get pointer to the output
   ImagePointer outputPtr = this->GetOutput();
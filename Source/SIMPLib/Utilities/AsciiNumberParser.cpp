@@ -0,0 +1,141 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "AsciiNumberParser.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <locale.h>
+#if defined(__APPLE__)
+#include <xlocale.h>
+#endif
+
+namespace
+{
+// The longest token that is handed to strtod. Anything longer is left to the QString conversion.
+const size_t k_MaxDoubleTokenLength = 128;
+
+#if defined(_MSC_VER)
+using CLocaleType = _locale_t;
+CLocaleType CreateCLocale()
+{
+  return _create_locale(LC_NUMERIC, "C");
+}
+double StrToDouble(const char* str, char** end, CLocaleType locale)
+{
+  return _strtod_l(str, end, locale);
+}
+#else
+using CLocaleType = locale_t;
+CLocaleType CreateCLocale()
+{
+  return newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(nullptr));
+}
+double StrToDouble(const char* str, char** end, CLocaleType locale)
+{
+  return strtod_l(str, end, locale);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CLocaleType GetCLocale()
+{
+  // Created once and intentionally never freed; it is shared by all threads
+  static CLocaleType cLocale = CreateCLocale();
+  return cLocale;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AsciiNumberParser::AsciiNumberParser() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AsciiNumberParser::~AsciiNumberParser() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AsciiNumberParser::ParseDouble(const char* begin, const char* end, double& value)
+{
+  TrimSpaces(begin, end);
+  size_t length = static_cast<size_t>(end - begin);
+  if(length == 0 || length >= k_MaxDoubleTokenLength)
+  {
+    return false;
+  }
+
+  // Only plain decimal and exponent notation is handled here. Hexadecimal floats, "inf" and
+  // "nan" are all rejected so that they follow the same path as before.
+  bool hasDigit = false;
+  char buffer[k_MaxDoubleTokenLength];
+  for(size_t i = 0; i < length; i++)
+  {
+    char c = begin[i];
+    if(c >= '0' && c <= '9')
+    {
+      hasDigit = true;
+    }
+    else if(c != '.' && c != '-' && c != '+' && c != 'e' && c != 'E')
+    {
+      return false;
+    }
+    buffer[i] = c;
+  }
+  if(!hasDigit)
+  {
+    return false;
+  }
+  buffer[length] = '\0';
+
+  CLocaleType cLocale = GetCLocale();
+  if(cLocale == nullptr)
+  {
+    return false;
+  }
+
+  char* parseEnd = nullptr;
+  double result = StrToDouble(buffer, &parseEnd, cLocale);
+  if(parseEnd != buffer + length || !std::isfinite(result))
+  {
+    return false;
+  }
+  value = result;
+  return true;
+}
@@ -0,0 +1,260 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The AsciiNumberParser class converts numbers directly from a range of characters
+ * [begin, end) without building a QString or requiring a null terminator. Leading and trailing
+ * spaces and tabs are ignored. Integers must be plain decimal numbers and floating point values
+ * must be written with digits, sign, '.' and 'e'/'E' only. Anything else (hexadecimal, "nan",
+ * a value that overflows the requested type) makes the conversion fail so that callers can fall
+ * back on the slower, more permissive QString conversions. The floating point conversion always
+ * uses the "C" locale, no matter what locale the application has set.
+ */
+class SIMPLib_EXPORT AsciiNumberParser
+{
+  public:
+    virtual ~AsciiNumberParser();
+
+    /**
+     * @brief Converts a signed decimal integer
+     * @param begin
+     * @param end
+     * @param value
+     * @return false if the characters are not a decimal integer or it overflows int64_t
+     */
+    static bool ParseInt64(const char* begin, const char* end, int64_t& value)
+    {
+      TrimSpaces(begin, end);
+      if(begin == end)
+      {
+        return false;
+      }
+      bool negative = false;
+      if(*begin == '-' || *begin == '+')
+      {
+        negative = (*begin == '-');
+        ++begin;
+      }
+      uint64_t magnitude = 0;
+      if(!ParseDigits(begin, end, magnitude))
+      {
+        return false;
+      }
+      if(negative)
+      {
+        if(magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1)
+        {
+          return false;
+        }
+        value = static_cast<int64_t>(0 - magnitude);
+        return true;
+      }
+      if(magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+      {
+        return false;
+      }
+      value = static_cast<int64_t>(magnitude);
+      return true;
+    }
+
+    /**
+     * @brief Converts an unsigned decimal integer. A leading '-' makes the conversion fail.
+     * @param begin
+     * @param end
+     * @param value
+     * @return false if the characters are not a decimal integer or it overflows uint64_t
+     */
+    static bool ParseUInt64(const char* begin, const char* end, uint64_t& value)
+    {
+      TrimSpaces(begin, end);
+      if(begin != end && *begin == '+')
+      {
+        ++begin;
+      }
+      return ParseDigits(begin, end, value);
+    }
+
+    /**
+     * @brief Converts a floating point value using the "C" locale
+     * @param begin
+     * @param end
+     * @param value
+     * @return false if the characters are not a finite floating point value
+     */
+    static bool ParseDouble(const char* begin, const char* end, double& value);
+
+    /**
+     * @brief Converts a value of type T. The default implementation always fails; the numeric
+     * types that SIMPL stores in DataArrays are specialized below.
+     * @param begin
+     * @param end
+     * @param value
+     * @return
+     */
+    template <typename T> static bool Parse(const char* /*begin*/, const char* /*end*/, T& /*value*/)
+    {
+      return false;
+    }
+
+    /**
+     * @brief Converts a signed integer and checks that it fits in T
+     */
+    template <typename T> static bool ParseSigned(const char* begin, const char* end, T& value)
+    {
+      int64_t i64 = 0;
+      if(!ParseInt64(begin, end, i64) || i64 < std::numeric_limits<T>::min() || i64 > std::numeric_limits<T>::max())
+      {
+        return false;
+      }
+      value = static_cast<T>(i64);
+      return true;
+    }
+
+    /**
+     * @brief Converts an unsigned integer and checks that it fits in T
+     */
+    template <typename T> static bool ParseUnsigned(const char* begin, const char* end, T& value)
+    {
+      uint64_t u64 = 0;
+      if(!ParseUInt64(begin, end, u64) || u64 > std::numeric_limits<T>::max())
+      {
+        return false;
+      }
+      value = static_cast<T>(u64);
+      return true;
+    }
+
+  protected:
+    AsciiNumberParser();
+
+    /**
+     * @brief Moves begin and end past any leading and trailing spaces or tabs
+     */
+    static void TrimSpaces(const char*& begin, const char*& end)
+    {
+      while(begin != end && (*begin == ' ' || *begin == '\t'))
+      {
+        ++begin;
+      }
+      while(end != begin && (*(end - 1) == ' ' || *(end - 1) == '\t'))
+      {
+        --end;
+      }
+    }
+
+    /**
+     * @brief Converts a run of at least one decimal digit that fills [begin, end)
+     */
+    static bool ParseDigits(const char* begin, const char* end, uint64_t& value)
+    {
+      if(begin == end)
+      {
+        return false;
+      }
+      uint64_t result = 0;
+      for(const char* c = begin; c != end; ++c)
+      {
+        uint64_t digit = static_cast<uint64_t>(static_cast<unsigned char>(*c) - '0');
+        if(digit > 9)
+        {
+          return false;
+        }
+        if(result > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+        {
+          return false;
+        }
+        result = result * 10 + digit;
+      }
+      value = result;
+      return true;
+    }
+
+  public:
+    AsciiNumberParser(const AsciiNumberParser&) = delete;            // Copy Constructor Not Implemented
+    AsciiNumberParser(AsciiNumberParser&&) = delete;                 // Move Constructor Not Implemented
+    AsciiNumberParser& operator=(const AsciiNumberParser&) = delete; // Copy Assignment Not Implemented
+    AsciiNumberParser& operator=(AsciiNumberParser&&) = delete;      // Move Assignment Not Implemented
+};
+
+template <> inline bool AsciiNumberParser::Parse<int8_t>(const char* begin, const char* end, int8_t& value)
+{
+  return ParseSigned<int8_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<uint8_t>(const char* begin, const char* end, uint8_t& value)
+{
+  return ParseUnsigned<uint8_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<int16_t>(const char* begin, const char* end, int16_t& value)
+{
+  return ParseSigned<int16_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<uint16_t>(const char* begin, const char* end, uint16_t& value)
+{
+  return ParseUnsigned<uint16_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<int32_t>(const char* begin, const char* end, int32_t& value)
+{
+  return ParseSigned<int32_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<uint32_t>(const char* begin, const char* end, uint32_t& value)
+{
+  return ParseUnsigned<uint32_t>(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<int64_t>(const char* begin, const char* end, int64_t& value)
+{
+  return ParseInt64(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<uint64_t>(const char* begin, const char* end, uint64_t& value)
+{
+  return ParseUInt64(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<double>(const char* begin, const char* end, double& value)
+{
+  return ParseDouble(begin, end, value);
+}
+template <> inline bool AsciiNumberParser::Parse<float>(const char* begin, const char* end, float& value)
+{
+  double dValue = 0.0;
+  if(!ParseDouble(begin, end, dValue) || dValue > std::numeric_limits<float>::max() || dValue < -std::numeric_limits<float>::max())
+  {
+    return false;
+  }
+  value = static_cast<float>(dValue);
+  // Values that underflow to zero are left to the slower conversion which reports them
+  return value != 0.0f || dValue == 0.0;
+}
@@ -0,0 +1,118 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MappedFileChunker.h"
+
+#include <atomic>
+
+namespace
+{
+std::atomic<qint64> s_WindowSize(64 * 1024 * 1024);
+std::atomic<size_t> s_ChunkSize(1024 * 1024);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileChunker::MappedFileChunker(QFile& file, const BoundaryTable& boundaries, size_t skipLines)
+: m_File(file)
+, m_Boundaries(boundaries)
+, m_SkipLines(skipLines)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileChunker::~MappedFileChunker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MappedFileChunker::setFirstWindowCheck(const FirstWindowCheck& check)
+{
+  m_FirstWindowCheck = check;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MappedFileChunker::getRecordsRead() const
+{
+  return m_RecordsRead;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MappedFileChunker::BoundaryTable MappedFileChunker::CreateBoundaryTable(const std::vector<char>& boundaries)
+{
+  BoundaryTable table;
+  table.fill(false);
+  for(char boundary : boundaries)
+  {
+    table[static_cast<unsigned char>(boundary)] = true;
+  }
+  return table;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MappedFileChunker::SetWindowSize(qint64 numBytes)
+{
+  s_WindowSize = std::max<qint64>(numBytes, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 MappedFileChunker::GetWindowSize()
+{
+  return s_WindowSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MappedFileChunker::SetChunkSize(size_t numBytes)
+{
+  s_ChunkSize = std::max<size_t>(numBytes, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MappedFileChunker::GetChunkSize()
+{
+  return s_ChunkSize;
+}
@@ -0,0 +1,334 @@
+/* ============================================================================
+ * Copyright (c) 2015 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/Common/ExecutionContext.h"
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The MappedFileChunker class reads a text file by memory mapping it in large windows
+ * and splitting each window into chunks that only hold whole records. A record ends at any of the
+ * boundary bytes, so a boundary table of just '\n' gives whole lines and a table of white space
+ * gives whole values. The records of every chunk are counted in parallel to find the index of the
+ * first record in each chunk, and then the chunks are parsed in parallel straight into their
+ * destination.
+ *
+ * Callers derive their own chunk type from MappedFileChunker::Chunk to carry whatever the count and
+ * parse steps need to report, such as the first error found in the chunk.
+ */
+class SIMPLib_EXPORT MappedFileChunker
+{
+  public:
+    using BoundaryTable = std::array<bool, 256>;
+
+    /**
+     * @brief Why read() returned
+     */
+    enum class Status : int
+    {
+      Complete,
+      NotMapped,
+      EndOfFile,
+      Stopped
+    };
+
+    /**
+     * @brief A run of whole records inside a mapped window. The byte offsets are relative to
+     * the start of the window.
+     */
+    struct Chunk
+    {
+      size_t begin = 0;
+      size_t end = 0;
+      size_t numRecords = 0;
+      size_t firstRecord = 0;
+    };
+
+    /**
+     * @brief Checks the start of the file before anything is read from it. It may move pos past
+     * a byte order mark and returns false when the file has to be read some other way.
+     */
+    using FirstWindowCheck = std::function<bool(const char* data, size_t size, size_t& pos)>;
+
+    /**
+     * @brief MappedFileChunker
+     * @param file An open file
+     * @param boundaries The bytes that end a record
+     * @param skipLines The number of lines at the start of the file that are not read
+     */
+    MappedFileChunker(QFile& file, const BoundaryTable& boundaries, size_t skipLines = 0);
+    virtual ~MappedFileChunker();
+
+    /**
+     * @brief Sets the check that is run on the first window of the file
+     * @param check
+     */
+    void setFirstWindowCheck(const FirstWindowCheck& check);
+
+    /**
+     * @brief Returns the number of records that have been parsed so far
+     * @return
+     */
+    size_t getRecordsRead() const;
+
+    /**
+     * @brief Creates a table where only the given bytes are boundaries
+     * @param boundaries
+     * @return
+     */
+    static BoundaryTable CreateBoundaryTable(const std::vector<char>& boundaries);
+
+    /**
+     * @brief Sets the size of each mapped window for all readers in the process. A window is
+     * doubled as needed to hold at least one whole record.
+     * @param numBytes
+     */
+    static void SetWindowSize(qint64 numBytes);
+    static qint64 GetWindowSize();
+
+    /**
+     * @brief Sets the approximate size of the chunks each window is split into for all readers
+     * in the process
+     * @param numBytes
+     */
+    static void SetChunkSize(size_t numBytes);
+    static size_t GetChunkSize();
+
+    /**
+     * @brief Reads records until numRecords have been parsed.
+     *
+     * countChunk(data, chunk) sets chunk.numRecords. parseChunk(data, chunk) parses the records
+     * starting at chunk.firstRecord. Both are called concurrently on different chunks and must not
+     * change anything that is shared. windowDone(chunks) runs after every window, with the chunks in
+     * file order, and returns false to stop reading.
+     * @param numRecords
+     * @param countChunk
+     * @param parseChunk
+     * @param windowDone
+     * @return Complete once numRecords were parsed, EndOfFile if the file ended first, NotMapped if
+     * the file could not be mapped or the first window check failed and Stopped if windowDone
+     * returned false
+     */
+    template <typename ChunkType, typename CountFunc, typename ParseFunc, typename WindowFunc>
+    Status read(size_t numRecords, const CountFunc& countChunk, const ParseFunc& parseChunk, const WindowFunc& windowDone)
+    {
+      const qint64 defaultWindowSize = GetWindowSize();
+      const size_t chunkSize = GetChunkSize();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      bool doParallel = ExecutionContext::IsParallel();
+#endif
+
+      qint64 fileSize = m_File.size();
+      qint64 fileOffset = 0;
+      qint64 windowSize = defaultWindowSize;
+      bool firstWindow = true;
+      size_t linesToSkip = m_SkipLines;
+      m_RecordsRead = 0;
+
+      while(m_RecordsRead < numRecords)
+      {
+        if(fileOffset >= fileSize)
+        {
+          return Status::EndOfFile;
+        }
+
+        qint64 mapSize = std::min(windowSize, fileSize - fileOffset);
+        uchar* mapped = m_File.map(fileOffset, mapSize);
+        if(nullptr == mapped)
+        {
+          return Status::NotMapped;
+        }
+        const char* data = reinterpret_cast<const char*>(mapped);
+        size_t dataSize = static_cast<size_t>(mapSize);
+        size_t pos = 0;
+
+        if(firstWindow && m_FirstWindowCheck && !m_FirstWindowCheck(data, dataSize, pos))
+        {
+          m_File.unmap(mapped);
+          return Status::NotMapped;
+        }
+
+        // Only whole records are read from a window unless it reaches the end of the file
+        size_t usable = dataSize;
+        if(fileOffset + mapSize < fileSize)
+        {
+          while(usable > pos && !m_Boundaries[static_cast<unsigned char>(data[usable - 1])])
+          {
+            usable--;
+          }
+          if(usable == pos)
+          {
+            // A single record is longer than the window, so try again with a larger window
+            m_File.unmap(mapped);
+            windowSize *= 2;
+            continue;
+          }
+        }
+
+        while(linesToSkip > 0 && pos < usable)
+        {
+          const char* newline = static_cast<const char*>(std::memchr(data + pos, '\n', usable - pos));
+          if(nullptr == newline)
+          {
+            // The rest of this line is in the next window
+            pos = usable;
+            break;
+          }
+          pos = static_cast<size_t>(newline - data) + 1;
+          linesToSkip--;
+        }
+
+        std::vector<ChunkType> chunks;
+        while(pos < usable)
+        {
+          ChunkType chunk;
+          chunk.begin = pos;
+          chunk.end = usable;
+          for(size_t i = pos + chunkSize; i < usable; i++)
+          {
+            if(m_Boundaries[static_cast<unsigned char>(data[i])])
+            {
+              chunk.end = i + 1;
+              break;
+            }
+          }
+          chunks.push_back(chunk);
+          pos = chunk.end;
+        }
+
+        ChunkTaskImpl<ChunkType, CountFunc> counter(data, chunks, countChunk);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+        if(doParallel)
+        {
+          ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size()), counter, tbb::auto_partitioner()); });
+        }
+        else
+#endif
+        {
+          counter.run(0, chunks.size());
+        }
+
+        size_t nextRecord = m_RecordsRead;
+        for(ChunkType& chunk : chunks)
+        {
+          chunk.firstRecord = nextRecord;
+          nextRecord += chunk.numRecords;
+        }
+
+        ChunkTaskImpl<ChunkType, ParseFunc> parser(data, chunks, parseChunk);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+        if(doParallel)
+        {
+          ExecutionContext::Execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size()), parser, tbb::auto_partitioner()); });
+        }
+        else
+#endif
+        {
+          parser.run(0, chunks.size());
+        }
+
+        m_File.unmap(mapped);
+
+        m_RecordsRead = std::min(nextRecord, numRecords);
+        fileOffset += static_cast<qint64>(usable);
+        windowSize = defaultWindowSize;
+        firstWindow = false;
+
+        if(!windowDone(chunks))
+        {
+          return Status::Stopped;
+        }
+      }
+
+      return Status::Complete;
+    }
+
+  private:
+    QFile& m_File;
+    BoundaryTable m_Boundaries;
+    size_t m_SkipLines = 0;
+    size_t m_RecordsRead = 0;
+    FirstWindowCheck m_FirstWindowCheck;
+
+    /**
+     * @brief The ChunkTaskImpl class runs a count or parse function on a range of chunks
+     */
+    template <typename ChunkType, typename Func> class ChunkTaskImpl
+    {
+    public:
+      ChunkTaskImpl(const char* data, std::vector<ChunkType>& chunks, const Func& func)
+      : m_Data(data)
+      , m_Chunks(chunks)
+      , m_Func(func)
+      {
+      }
+      virtual ~ChunkTaskImpl() = default;
+
+      void run(size_t start, size_t end) const
+      {
+        for(size_t c = start; c < end; c++)
+        {
+          m_Func(m_Data, m_Chunks[c]);
+        }
+      }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      void operator()(const tbb::blocked_range<size_t>& r) const
+      {
+        run(r.begin(), r.end());
+      }
+#endif
+
+    private:
+      const char* m_Data;
+      std::vector<ChunkType>& m_Chunks;
+      const Func& m_Func;
+    };
+
+    MappedFileChunker(const MappedFileChunker&) = delete; // Copy Constructor Not Implemented
+    void operator=(const MappedFileChunker&) = delete;    // Move assignment Not Implemented
+};
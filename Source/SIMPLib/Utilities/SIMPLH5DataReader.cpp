@@ -32,6 +32,7 @@
 
 #include "SIMPLH5DataReader.h"
 
+#include <mutex>
 #include <sstream>
 
 #include <QtCore/QTextStream>
@@ -41,6 +42,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+#include "H5Support/H5Lite.h"
 #include "H5Support/QH5Utilities.h"
 #include "H5Support/H5ScopedSentinel.h"
 
@@ -129,6 +131,7 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const Dat
   fVersion = m_FileVersion.toFloat(&check);
   if(fVersion < 5.0 || err < 0)
   {
+    std::lock_guard<std::recursive_mutex> h5Lock(H5Lite::GetLibraryMutex());
     QH5Utilities::closeFile(m_FileId);
     m_FileId = QH5Utilities::openFile(m_CurrentFilePath, false); // Re-Open the file as Read/Write
     err = H5Lmove(m_FileId, "VoxelDataContainer", m_FileId, SIMPL::Defaults::DataContainerName.toLatin1().data(), H5P_DEFAULT, H5P_DEFAULT);
@@ -149,7 +152,7 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const Dat
     emit errorGenerated(Title, ss, -251);
     return DataContainerArray::NullPointer();
   }
-  hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), 0);
+  hid_t dcaGid = QH5Utilities::openHDF5Object(m_FileId, SIMPL::StringConstants::DataContainerGroupName);
   if(dcaGid < 0)
   {
     QString ss = QObject::tr("Error attempting to open the HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
@@ -165,7 +168,7 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const Dat
     return DataContainerArray::NullPointer();
   }
 
-  err = H5Gclose(dcaGid);
+  err = QH5Utilities::closeHDF5Object(dcaGid);
   dcaGid = -1;
 
   bool result = readDataContainerBundles(m_FileId, dca);
@@ -281,7 +284,7 @@ bool SIMPLH5DataReader::readPipelineJson(QString &json)
 bool SIMPLH5DataReader::readDataContainerBundles(hid_t fileId, DataContainerArray::Pointer dca)
 {
   herr_t err = 0;
-  hid_t dcbGroupId = H5Gopen(fileId, SIMPL::StringConstants::DataContainerBundleGroupName.toLatin1().constData(), H5P_DEFAULT);
+  hid_t dcbGroupId = QH5Utilities::openHDF5Object(fileId, SIMPL::StringConstants::DataContainerBundleGroupName);
   if(dcbGroupId < 0)
   {
     // NO Bundles are available to read so just return.
@@ -308,7 +311,7 @@ bool SIMPLH5DataReader::readDataContainerBundles(hid_t fileId, DataContainerArra
     QString bundleName = iter.next();
     DataContainerBundle::Pointer bundle = DataContainerBundle::New(bundleName);
 
-    hid_t bundleId = H5Gopen(dcbGroupId, bundleName.toLatin1().constData(), H5P_DEFAULT);
+    hid_t bundleId = QH5Utilities::openHDF5Object(dcbGroupId, bundleName);
     sentinel.addGroupId(&bundleId); // Make sure this group gets closed
 
     // Read in the Data Container Names
@@ -349,7 +352,7 @@ bool SIMPLH5DataReader::readDataContainerBundles(hid_t fileId, DataContainerArra
     dca->addDataContainerBundle(bundle);
   }
 
-  H5Gclose(dcbGroupId);
+  QH5Utilities::closeHDF5Object(dcbGroupId);
   dcbGroupId = -1;
   return true;
 }
@@ -24,6 +24,8 @@ set(SIMPLib_Utilities_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReaderRequirements.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibEndian.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringOperations.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AsciiNumberParser.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MappedFileChunker.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TimeUtilities.h
 )
 
@@ -36,6 +38,8 @@ set(SIMPLib_Utilities_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReader.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLH5DataReaderRequirements.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringOperations.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AsciiNumberParser.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MappedFileChunker.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TestObserver.cpp
 )
 
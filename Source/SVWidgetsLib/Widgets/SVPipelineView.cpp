@@ -141,6 +141,7 @@ void SVPipelineView::setupGui()
   m_ActionCopy->setShortcut(QKeySequence::Copy);
   m_ActionPaste->setShortcut(QKeySequence::Paste);
   m_ActionClearPipeline->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_Backspace));
+  m_ActionRefreshPipeline->setShortcut(QKeySequence::Refresh);
 
   m_ActionCut->setDisabled(true);
   m_ActionCopy->setDisabled(true);
@@ -172,6 +173,7 @@ void SVPipelineView::connectSignalsSlots()
   connect(m_ActionPaste, &QAction::triggered, this, &SVPipelineView::listenPasteTriggered);
 
   connect(m_ActionClearPipeline, &QAction::triggered, this, &SVPipelineView::listenClearPipelineTriggered);
+  connect(m_ActionRefreshPipeline, &QAction::triggered, this, &SVPipelineView::refreshPipeline);
 }
 
 // -----------------------------------------------------------------------------
@@ -331,6 +333,8 @@ void SVPipelineView::preflightPipeline()
 
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
+  // Only the filters downstream of the first changed filter need to be preflighted again
+  pipeline->setPreflightCache(m_PreflightCache);
 
   qDebug() << "Prepping Filters for preflight... ";
 
@@ -397,6 +401,23 @@ void SVPipelineView::preflightPipeline()
   
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::clearPreflightCache()
+{
+  m_PreflightCache->clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineView::refreshPipeline()
+{
+  clearPreflightCache();
+  preflightPipeline();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1486,6 +1507,7 @@ void SVPipelineView::toRunningState()
   }
 
   m_ActionClearPipeline->setDisabled(true);
+  m_ActionRefreshPipeline->setDisabled(true);
   getActionUndo()->setDisabled(true);
   getActionRedo()->setDisabled(true);
 }
@@ -1520,6 +1542,7 @@ void SVPipelineView::toStoppedState()
   }
 
   m_ActionClearPipeline->setEnabled(model->rowCount() > 0);
+  m_ActionRefreshPipeline->setEnabled(true);
 
   getActionUndo()->setEnabled(true);
   getActionRedo()->setEnabled(true);
@@ -1793,6 +1816,7 @@ void SVPipelineView::requestFilterItemContextMenu(const QPoint& pos, const QMode
 
   menu.addSeparator();
 
+  menu.addAction(m_ActionRefreshPipeline);
   menu.addAction(m_ActionClearPipeline);
 
   menu.addSeparator();
@@ -1842,6 +1866,7 @@ void SVPipelineView::requestSinglePipelineContextMenu(QMenu& menu)
 {
   menu.addSeparator();
 
+  menu.addAction(m_ActionRefreshPipeline);
   menu.addAction(m_ActionClearPipeline);
 }
 
@@ -1933,6 +1958,7 @@ void SVPipelineView::requestDefaultContextMenu(const QPoint& pos)
   QMenu menu;
   menu.addAction(m_ActionPaste);
   menu.addSeparator();
+  menu.addAction(m_ActionRefreshPipeline);
   menu.addAction(m_ActionClearPipeline);
 
   menu.exec(pos);
@@ -94,6 +94,7 @@ public:
   SIMPL_GET_PROPERTY(QAction*, ActionCopy)
   SIMPL_GET_PROPERTY(QAction*, ActionPaste)
   SIMPL_GET_PROPERTY(QAction*, ActionClearPipeline)
+  SIMPL_GET_PROPERTY(QAction*, ActionRefreshPipeline)
 
   SVPipelineView(QWidget* parent = nullptr);
   ~SVPipelineView() override;
@@ -278,6 +279,17 @@ public slots:
    */
   void preflightPipeline();
 
+  /**
+   * @brief Forgets every saved preflight result so that the next preflight starts from the first
+   * filter. Needed when something a filter reads, such as a file on disk, changed behind its back.
+   */
+  void clearPreflightCache();
+
+  /**
+   * @brief Clears the preflight cache and preflights the whole pipeline again
+   */
+  void refreshPipeline();
+
   /**
    * @brief runPipeline
    * @param pipelineIndex
@@ -421,6 +433,7 @@ private:
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
   QVector<DataContainerArray::Pointer> m_PreflightDataContainerArrays;
+  FilterPipeline::PreflightCacheShPtr m_PreflightCache = std::make_shared<FilterPipeline::PreflightCache>();
   QList<QObject*> m_PipelineMessageObservers;
 
   QUndoCommand* m_MoveCommand = nullptr;
@@ -434,6 +447,7 @@ private:
   QAction* m_ActionCopy = nullptr;
   QAction* m_ActionPaste = nullptr;
   QAction* m_ActionClearPipeline = new QAction("Clear Pipeline", this);
+  QAction* m_ActionRefreshPipeline = new QAction("Refresh Pipeline", this);
 
   QPixmap m_DisableBtnPixmap;
   QPixmap m_DisableHighlightedPixmap;
@@ -127,6 +127,7 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
 /******************************************************************************
  *
  ******************************************************************************/
+#include "SIMPLib/Common/ExecutionContext.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 
 /**
@@ -151,7 +152,29 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
             numElements *= b.shape(e);                                                                                                                                                                 \
           }                                                                                                                                                                                            \
           return DataArrayType::WrapPointer(reinterpret_cast<T*>(b.mutable_data(0)), static_cast<size_t>(numElements), QVector<size_t>::fromStdVector(cDims), name, ownsData);                         \
-        })) /* Class instance method setValue */                                                                                                                                                       \
+        }),                                                                                                                                                                                            \
+             py::keep_alive<1, 2>()) /* The wrapped numpy array lives at least as long as the DataArray */                                                                                             \
+        /* Buffer protocol: numpy.asarray(dataArray) is a writable view of the data without a copy. The */                                                                                             \
+        /* shape is the number of tuples followed by the component dimensions. The view keeps the */                                                                                                   \
+        /* DataArray alive, but it must not be used after the DataArray is resized. */                                                                                                                 \
+        .def_buffer([](DataArrayType& array) -> py::buffer_info {                                                                                                                                      \
+          if(!array.isAllocated())                                                                                                                                                                     \
+          {                                                                                                                                                                                            \
+            throw py::buffer_error("DataArray '" + array.getName().toStdString() + "' is not allocated");                                                                                              \
+          }                                                                                                                                                                                            \
+          QVector<size_t> cDims = array.getComponentDimensions();                                                                                                                                      \
+          std::vector<ssize_t> shape(1, static_cast<ssize_t>(array.getNumberOfTuples()));                                                                                                              \
+          for(size_t cDim : cDims)                                                                                                                                                                     \
+          {                                                                                                                                                                                            \
+            shape.push_back(static_cast<ssize_t>(cDim));                                                                                                                                               \
+          }                                                                                                                                                                                            \
+          std::vector<ssize_t> strides(shape.size(), static_cast<ssize_t>(sizeof(T)));                                                                                                                 \
+          for(size_t d = shape.size() - 1; d > 0; d--)                                                                                                                                                 \
+          {                                                                                                                                                                                            \
+            strides[d - 1] = strides[d] * shape[d];                                                                                                                                                    \
+          }                                                                                                                                                                                            \
+          return py::buffer_info(array.getPointer(0), sizeof(T), py::format_descriptor<T>::format(), static_cast<ssize_t>(shape.size()), shape, strides);                                              \
+        }) /* Class instance method setValue */                                                                                                                                                        \
         .def("setValue", &DataArrayType::setValue, py::arg("index"), py::arg("value"))                                                                                                                 \
         .def("getValue", &DataArrayType::getValue, py::arg("index"))                                                                                                                                   \
         .def_property("Name", &DataArrayType::getName, &DataArrayType::setName)                                                                                                                        \
@@ -269,6 +292,11 @@ PYBIND11_MODULE(dream3d_py, m)
 
   py::enum_<SIMPL::InfoStringFormat>(mod, "InfoStringFormat").value("HtmlFormat", SIMPL::InfoStringFormat::HtmlFormat).value("UnknownFormat", SIMPL::InfoStringFormat::UnknownFormat).export_values();
 
+  py::class_<ExecutionContext>(mod, "ExecutionContext")
+      .def_static("SetMaxThreads", &ExecutionContext::SetMaxThreads, py::arg("numThreads"))
+      .def_static("GetMaxThreads", &ExecutionContext::GetMaxThreads)
+      .def_static("GetNumThreads", &ExecutionContext::GetNumThreads);
+
   
   //--------------------------------------------------------------------------
   // This header file is auto-generated and contains some C++ code to create
@@ -65,9 +65,34 @@ def DataArrayTest():
     err = sc.WriteDREAM3DFile(sd.GetTestTempDirectory() + "/DataArrayTest.dream3d", dca, True)
     assert err == 0
 
+def NumpyViewTest():
+    """
+    Checks that numpy.asarray() on a SIMPL DataArray is a writable view of the
+    DataArray memory and not a copy.
+    """
+    numTuples = 10
+    array = simpl.Int32ArrayType(numTuples, "Int32 NumpyView", True)
+    for x in range(numTuples):
+        array.setValue(x, x)
+
+    view = np.asarray(array)
+    assert view.shape == (numTuples, 1)
+    assert view.dtype == np.int32
+    assert view[numTuples - 1, 0] == numTuples - 1
+
+    # Writes through the view must be visible on the C++ side
+    view[:, 0] = np.arange(numTuples, dtype=np.int32) * 2
+    for x in range(numTuples):
+        assert array.getValue(x) == x * 2
+
+    # The view holds a reference to the DataArray so it stays valid
+    del array
+    assert view[numTuples - 1, 0] == (numTuples - 1) * 2
+
 """
 Main entry point for python script
 """
 if __name__ == "__main__":
     DataArrayTest()
+    NumpyViewTest()
     print("[DataArrayTest] Complete")